@@ -13,12 +13,17 @@
 #include <array>
 #include <iostream>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "common.hpp"
 #include "pieces.hpp"
+#include "evaluation.hpp"
+#include "zobrist.hpp"
 
 inline constexpr int BOARD_SIZE              = 8;  ///< Standard chess board size (8x8)
 inline constexpr int MAX_OUT_EACH_SIDE_BOARD = 15; ///< Maximum display padding on each side
+inline constexpr int STANDARD_PIECE_COUNT    = 32; ///< Number of pieces in the standard starting position
 
 /// @brief A matix of characters representing chess pieces.
 /// @note  This container has fixed size. It store char that represent how pieces are
@@ -56,8 +61,14 @@ class Board
     /// @note  The board takes ownership of the piece unique pointer.
     void addPiece(std::unique_ptr<Piece> piece);
 
+    /// @brief   Reserve room for pieces in the pieces container.
+    /// @param   count Number of pieces the board should hold without reallocating.
+    /// @details The capacity is kept by cleanPieces(), so recycled boards do not reallocate.
+    void reservePieces(const std::size_t count);
+
     /// @brief   Initialize the board with standard chess starting position.
-    /// @details Sets up all pawns in their starting positions for a new game.
+    /// @details Removes any previous pieces, properties and history, then sets up all pieces
+    ///          in their starting positions for a new game with white to move.
     void initializeStandardSetup();
 
     /// @brief   Display the current board state to console.
@@ -65,10 +76,137 @@ class Board
     ///          file labels (a-h) and rank numbers (1-8).
     void display() const;
 
+    /// @brief   Evaluate the current position statically.
+    /// @return  Tapered material, piece-square and pawn structure score in centipawns from
+    ///          white's point of view.
+    /// @details Blends the running sums kept up to date by the board mutators plus the pawn
+    ///          structure score. The latter comes from the calling thread's PawnHashTable, and
+    ///          only a miss walks the pieces. Apart from creating that table on first use in a
+    ///          thread, nothing is allocated.
+    int evaluate() const;
+
+    /// @brief   Check whether a single move is pseudo-legal on the board.
+    /// @param   move The move to validate, e.g. received from a client.
+    /// @return  True if the move is pseudo-legal: a piece of the side to move stands on the start
+    ///          position and its movement rules allow reaching the end position. The move may
+    ///          still leave the own king in check, so true does not mean the move is legal.
+    /// @details Only the moving piece generates moves, and only the captures when the end
+    ///          position holds an opponent piece. Reuses per-thread buffers, so repeated calls
+    ///          do not allocate.
+    /// @note    Only Pawn has movement rules so far. Pins and check evasion are not validated
+    ///          yet, since no piece can generate the attacks they need.
+    bool isLegal(const Move& move) const;
+
+    /// @brief      Generate the moves of the side to move.
+    /// @param[out] moves Vector to be filled with the moves of all pieces of the side to move.
+    /// @details    Collects positions and colors of all pieces once and runs each piece's
+    ///             movement rules, so the same caveats as isLegal() apply.
+    void availableMoves(std::vector<Move>& moves) const;
+
+    /// @brief   Set up the board from a position in Forsyth-Edwards Notation.
+    /// @param   fen The FEN string. Fields after the piece placement are optional.
+    /// @throws  std::invalid_argument if the FEN cannot be parsed; the board is left unchanged.
+    /// @details Reads piece placement, side to move, castling rights, en passant square and
+    ///          halfmove clock, and checks the fullmove number. Castling must be "-" or a subset
+    ///          of "KQkq", counters non-negative integers, the en passant square on rank 6 with
+    ///          white to move and on rank 3 with black to move, and nothing may follow the
+    ///          fullmove number. The en passant square is stored as the double step that
+    ///          allows it, and the game history is cleared.
+    void loadFen(const std::string& fen);
+
+    /// @brief   Recompute the evaluation running sums from scratch.
+    /// @details Walks all pieces once. Only needed after pieces were moved
+    ///          without going through the board, e.g. via Piece::set_position().
+    void refreshEvaluation();
+
+    /// @brief  Get the Zobrist key of the pawn placement.
+    /// @return XOR of the keys of all pawns on the board, 0 without pawns.
+    ZobristKey getPawnKey() const;
+
+    /// @brief  Get the Zobrist key of the current position.
+    /// @return XOR of the keys of all pieces, of the castling rights still available, of the
+    ///         side to move and of the en passant file.
+    /// @details The en passant file is only hashed when a pawn of the side to move can actually
+    ///          capture, so positions that only differ by an unusable double step stay equal.
+    ZobristKey getPositionKey() const;
+
+    /// @brief  Get the state properties of the board.
+    /// @return Reference to the castling flags, last move and pawn move counter.
+    const Properties& getProperties() const;
+
+    /// @brief Replace the state properties of the board.
+    /// @param props The new castling flags, last move, pawn move counter and halfmove clock.
+    /// @note  turns_since_pawn_move only restarts on pawn moves, since en passant relies on it;
+    ///        halfmove_clock must also be reset on captures by whoever applies moves.
+    void setProperties(const Properties& props);
+
+    /// @brief   Record the current position in the game history.
+    /// @details Must be called right before a move is applied, once per ply.
+    void pushHistory();
+
+    /// @brief   Drop the most recent position from the game history.
+    /// @details Must be called right after a move is taken back.
+    void popHistory();
+
+    /// @brief Forget all recorded positions, e.g. when a new game starts.
+    void clearHistory();
+
+    /// @brief   Count earlier occurrences of the current position.
+    /// @return  Number of recorded positions equal to the current one with the same side to move.
+    /// @details Only scans back as far as the halfmove clock allows, since no position before
+    ///          the last pawn move or capture can repeat.
+    int countRepetitions() const;
+
+    /// @brief  Check for a repetition inside the search tree.
+    /// @return True if the current position occurred at least once before.
+    /// @note   Twofold repetition is enough to score a search node as a draw.
+    bool isRepetition() const;
+
+    /// @brief  Check for a threefold repetition.
+    /// @return True if the current position occurred at least twice before.
+    bool isThreefoldRepetition() const;
+
+    /// @brief  Check for the fifty-move rule.
+    /// @return True if 100 plies passed without a pawn move or capture.
+    bool isFiftyMoveDraw() const;
+
+    /// @brief   Check whether neither side can deliver checkmate.
+    /// @return  True for king against king, a single minor piece against a bare king,
+    ///          or bishops only, all on squares of the same color.
+    /// @details Returns early through the pawn key, so positions with pawns never walk the pieces.
+    bool hasInsufficientMaterial() const;
+
+    /// @brief  Check all draw rules that do not need move generation.
+    /// @return True for a threefold repetition, the fifty-move rule or insufficient material.
+    bool isDraw() const;
+
   private:
-    Piece::List pieces = {}; ///< Collection of pieces currently on the board
-    BoardGrid   grid   = {}; ///< 8x8 character grid for display
-    Properties  state  = {}; ///< Current state properties of the board
+    /// @brief   Get the pawn structure score of the current pawn placement.
+    /// @return  Pawn structure score from white's point of view.
+    /// @details Probes the calling thread's PawnHashTable by pawn key and only walks
+    ///          the pieces on a miss, filling fixed-size pawn grids.
+    Score evaluatePawnStructure() const;
+
+    /// @brief Add or remove the evaluation contribution of a piece to the running sums.
+    /// @param piece The piece whose material, piece-square value and phase are applied.
+    /// @param sign  +1 when the piece is placed, -1 when it is removed.
+    void accumulateEvaluation(const Piece& piece, const int sign);
+
+    /// @brief  Get the file on which the side to move can capture en passant.
+    /// @return File of the pawn that just made a double step if an opponent pawn stands next
+    ///         to it, ' ' otherwise.
+    /// @note   Pins are not checked, so the capture is only known to be pseudo-legal.
+    char passantFile() const;
+
+    Piece::List pieces     = {}; ///< Collection of pieces currently on the board
+    BoardGrid   grid       = {}; ///< 8x8 character grid for display
+    Properties  state      = {}; ///< Current state properties of the board
+    Score       eval_score = {}; ///< Running material and piece-square sum of all pieces
+    int         eval_phase = 0;  ///< Running game phase of all pieces
+    ZobristKey  pawn_key   = 0;  ///< Running Zobrist key of all pawns
+    ZobristKey  piece_key  = 0;  ///< Running Zobrist key of all pieces
+
+    std::vector<ZobristKey> key_history = {}; ///< Keys of the positions before each move of the game
 };
 
 #endif // ICHESS_SRC_BOARD
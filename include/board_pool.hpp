@@ -0,0 +1,62 @@
+/// @file      board_pool.hpp
+/// @brief     Pool of preallocated, recycled Board instances.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Defines the BoardPool class that owns a fixed set of boards and hands
+///            them out to games, so hosting many games does not construct and destroy
+///            a Board per game.
+
+#ifndef ICHESS_SRC_BOARD_POOL
+#define ICHESS_SRC_BOARD_POOL
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "board.hpp"
+
+/// @class   BoardPool
+/// @brief   Owns a fixed number of boards and recycles them between games.
+/// @details All boards are created by the constructor and only freed with the pool.
+///          Released boards are reset and handed out again by acquire().
+/// @note    Not thread-safe. Each worker thread is expected to own its own pool,
+///          so games sharded on that thread never contend on a lock.
+class BoardPool
+{
+  public:
+    /// @brief   Construct a BoardPool.
+    /// @param   size Number of boards to preallocate.
+    /// @details Every board also reserves room for the 32 pieces of a standard game.
+    explicit BoardPool(std::size_t size);
+
+    /// @brief   Take a board out of the pool.
+    /// @return  Pointer to an empty board owned by the pool, or nullptr if all boards are in use.
+    /// @details The pointer stays valid until the pool is destroyed.
+    Board* acquire();
+
+    /// @brief   Return a board to the pool.
+    /// @param   board Board previously returned by acquire() of this pool.
+    /// @throws  std::invalid_argument if the board does not belong to this pool or is not in use,
+    ///          so a board can never be handed to two games at once.
+    /// @details Removes its pieces, properties and history so the next game starts clean.
+    ///          Null pointers are ignored.
+    void release(Board* board);
+
+    /// @brief  Get the number of boards owned by the pool.
+    /// @return Total board count, in use or not.
+    std::size_t size() const;
+
+    /// @brief  Get the number of boards ready to be acquired.
+    /// @return Count of boards not currently in use.
+    std::size_t available() const;
+
+  private:
+    std::unique_ptr<Board[]> boards      = nullptr; ///< All boards owned by the pool, stored contiguously
+    std::size_t              board_count = 0;       ///< Number of boards in the boards array
+    std::vector<bool>        in_use      = {};      ///< Whether the board at the same index is acquired
+    std::vector<Board*>      free_list   = {};      ///< Boards not currently in use
+};
+
+#endif // ICHESS_SRC_BOARD_POOL
@@ -37,6 +37,15 @@ inline bool is_in_grid_range(const Position& pos)
 /// @return True if positions are equal, false otherwise.
 inline bool operator==(const Position& a, const Position& b) { return (a.file == b.file && a.rank == b.rank); }
 
+/// @struct  Move
+/// @brief   Represents a move of one piece from a start to an end position.
+/// @details Uses the same start/end naming as the last move stored in Properties.
+struct Move
+{
+    Position start = {' ', ' '}; ///< Position the piece moves from
+    Position end   = {' ', ' '}; ///< Position the piece moves to
+};
+
 /// @struct  Properties
 /// @brief   Stores additional information about the board state.
 /// @details This struct stores information about the state of the board that is not directly
@@ -54,6 +63,8 @@ struct Properties
     Position last_move_start                 = {' ', ' '}; ///< The start position of the last move.
     Position last_move_end                   = {' ', ' '}; ///< The end position of the last move.
     int      turns_since_pawn_move           = 0;          ///< Turns since a pawn was moved.
+    int      halfmove_clock                  = 0;          ///< Plies since the last pawn move or capture.
+    bool     white_to_move                   = true;       ///< Whether white is the side to move.
 };
 
 /// @brief Default properties constant.
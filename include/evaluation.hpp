@@ -0,0 +1,82 @@
+/// @file      evaluation.hpp
+/// @brief     Material and piece-square-table evaluation terms.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Defines the tapered (midgame/endgame) score type, the piece values keyed
+///            off Piece::Type and the piece-square tables used by the Board evaluation.
+
+#ifndef ICHESS_SRC_EVALUATION
+#define ICHESS_SRC_EVALUATION
+
+#include <array>
+
+#include "common.hpp"
+#include "pieces.hpp"
+
+inline constexpr int MAX_GAME_PHASE = 24; ///< Game phase of the starting position (all minor and major pieces)
+
+/// @struct  Score
+/// @brief   Pair of midgame and endgame evaluation terms in centipawns.
+/// @details Both terms are accumulated separately and blended by the game phase
+///          when the final evaluation is requested.
+struct Score
+{
+    int mg = 0; ///< Midgame term in centipawns
+    int eg = 0; ///< Endgame term in centipawns
+};
+
+/// @brief A file by rank occupancy grid of pawns, indexed from 0 ('a', '1') to 7 ('h', '8').
+using PawnGrid = std::array<std::array<bool, 8>, 8>;
+
+/// @brief  Add two scores term by term.
+/// @return Score with the summed midgame and endgame terms.
+inline Score operator+(const Score& a, const Score& b) { return {a.mg + b.mg, a.eg + b.eg}; }
+
+/// @brief  Subtract two scores term by term.
+/// @return Score with the subtracted midgame and endgame terms.
+inline Score operator-(const Score& a, const Score& b) { return {a.mg - b.mg, a.eg - b.eg}; }
+
+/// @brief  Get the material value of a piece type.
+/// @param  type The type of the piece.
+/// @return Midgame and endgame value in centipawns, zero for Piece::Type::NONE.
+Score piece_value(const Piece::Type type);
+
+/// @brief  Get the game phase weight of a piece type.
+/// @param  type The type of the piece.
+/// @return 1 for knights and bishops, 2 for rooks, 4 for queens and 0 otherwise.
+int piece_phase(const Piece::Type type);
+
+/// @brief   Get the full evaluation contribution of a piece on a square.
+/// @param   type  The type of the piece.
+/// @param   color The color of the piece.
+/// @param   pos   The position of the piece on the board.
+/// @return  Material plus piece-square value, positive for white and negative for black.
+/// @details Tables are written from white's point of view; black pieces use the rank-mirrored square.
+///          Pieces without color or outside the board contribute nothing.
+Score piece_square_value(const Piece::Type type, const Piece::Color color, const Position& pos);
+
+/// @brief   Evaluate the pawn structure of both sides.
+/// @param   white_pawns Positions of all white pawns.
+/// @param   black_pawns Positions of all black pawns.
+/// @return  Pawn structure score, positive when white's structure is better.
+/// @details Penalizes doubled, isolated and backward pawns and rewards passed pawns by rank.
+///          Depends on pawn placement only, so results can be cached by the pawn Zobrist key.
+Score pawn_structure(const Piece::PositionList& white_pawns, const Piece::PositionList& black_pawns);
+
+/// @brief   Evaluate the pawn structure of both sides.
+/// @param   white_pawns Occupancy grid of all white pawns.
+/// @param   black_pawns Occupancy grid of all black pawns.
+/// @return  Pawn structure score, positive when white's structure is better.
+/// @details Same terms as pawn_structure(). Works on fixed-size grids only, so it
+///          never allocates.
+Score pawn_grid_structure(const PawnGrid& white_pawns, const PawnGrid& black_pawns);
+
+/// @brief  Blend a midgame/endgame score by the game phase.
+/// @param  score The accumulated midgame and endgame terms.
+/// @param  phase The game phase, clamped to [0, MAX_GAME_PHASE].
+/// @return The tapered score in centipawns.
+int taper(const Score& score, int phase);
+
+#endif // ICHESS_SRC_EVALUATION
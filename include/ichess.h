@@ -0,0 +1,140 @@
+/// @file      ichess.h
+/// @brief     Stable C interface of the Inheritance Chess engine.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Declares the C ABI exported by the libichess shared library, for use from
+///            other languages through their foreign function interfaces.
+///            All output goes to caller-provided buffers; nothing allocated by the library
+///            crosses the boundary except boards, which are released with ichess_board_destroy().
+///            Batch entry points process many FEN positions per call to amortize call overhead.
+
+#ifndef ICHESS_SRC_ICHESS_H
+#define ICHESS_SRC_ICHESS_H
+
+#include <stddef.h>
+
+#if defined(ICHESS_BUILDING_LIBRARY) && defined(_WIN32)
+  #define ICHESS_API __declspec(dllexport)
+#elif defined(ICHESS_BUILDING_LIBRARY)
+  #define ICHESS_API __attribute__((visibility("default")))
+#else
+  #define ICHESS_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /// @enum    ichess_status
+  /// @brief   Result codes returned by the C interface.
+  /// @details Zero means success, negative values are errors.
+  enum ichess_status
+  {
+    ICHESS_OK               = 0,  ///< The call succeeded
+    ICHESS_INVALID_ARGUMENT = -1, ///< A required pointer was null or a value was out of range
+    ICHESS_INVALID_FEN      = -2, ///< A FEN string could not be parsed
+    ICHESS_BUFFER_TOO_SMALL = -3, ///< An output buffer could not hold all results
+    ICHESS_INTERNAL_ERROR   = -4  ///< An unexpected error occurred inside the engine
+  };
+
+  /// @struct  ichess_move
+  /// @brief   A move in algebraic coordinates, e.g. 'e','2','e','4'.
+  typedef struct ichess_move
+  {
+      char start_file; ///< File the piece moves from, 'a' through 'h'
+      char start_rank; ///< Rank the piece moves from, '1' through '8'
+      char end_file;   ///< File the piece moves to, 'a' through 'h'
+      char end_rank;   ///< Rank the piece moves to, '1' through '8'
+  } ichess_move;
+
+  /// @brief Opaque handle to a board owned by the library.
+  typedef struct ichess_board ichess_board;
+
+  /// @brief  Create an empty board.
+  /// @return Handle to the new board, or NULL if it could not be allocated.
+  ICHESS_API ichess_board* ichess_board_create(void);
+
+  /// @brief Destroy a board created by ichess_board_create().
+  /// @param board The board to destroy. NULL is ignored.
+  ICHESS_API void ichess_board_destroy(ichess_board* board);
+
+  /// @brief  Set up the standard starting position.
+  /// @param  board The board to set up.
+  /// @return ICHESS_OK, or ICHESS_INVALID_ARGUMENT if board is NULL.
+  ICHESS_API int ichess_board_standard_setup(ichess_board* board);
+
+  /// @brief  Set up a position from a FEN string.
+  /// @param  board The board to set up.
+  /// @param  fen   Null-terminated FEN string.
+  /// @return ICHESS_OK, ICHESS_INVALID_ARGUMENT or ICHESS_INVALID_FEN. The board is unchanged on error.
+  ICHESS_API int ichess_board_load_fen(ichess_board* board, const char* fen);
+
+  /// @brief      List the pseudo-legal moves of the side to move.
+  /// @param[in]  board    The board to generate moves on.
+  /// @param[out] moves    Buffer receiving up to capacity moves. May be NULL when capacity is 0.
+  /// @param[in]  capacity Number of moves the buffer can hold.
+  /// @param[out] count    Total number of moves, even when it exceeds capacity.
+  /// @return     ICHESS_OK, ICHESS_INVALID_ARGUMENT, or ICHESS_BUFFER_TOO_SMALL when only the
+  ///             first capacity moves were written.
+  /// @warning    Moves follow the movement rules of each piece only: moves that leave the own
+  ///             king in check are not filtered out, and only pawns have movement rules so far.
+  ///             Do not treat the result as a list of legal moves.
+  ICHESS_API int ichess_board_pseudo_legal_moves(const ichess_board* board,
+                                                 ichess_move*        moves,
+                                                 size_t              capacity,
+                                                 size_t*             count);
+
+  /// @brief   Check whether a single move is pseudo-legal.
+  /// @param   board The board to check the move on.
+  /// @param   move  The move to check.
+  /// @return  1 if the move is pseudo-legal, 0 if not, ICHESS_INVALID_ARGUMENT if board is NULL.
+  /// @warning Same limits as ichess_board_pseudo_legal_moves(): pins and checks are not
+  ///          validated, so a result of 1 does not mean the move is legal.
+  ICHESS_API int ichess_board_is_pseudo_legal(const ichess_board* board, ichess_move move);
+
+  /// @brief      Evaluate the position statically.
+  /// @param[in]  board The board to evaluate.
+  /// @param[out] score Score in centipawns from white's point of view.
+  /// @return     ICHESS_OK or ICHESS_INVALID_ARGUMENT.
+  ICHESS_API int ichess_board_evaluate(const ichess_board* board, int* score);
+
+  /// @brief      Evaluate many FEN positions statically in one call.
+  /// @param[in]  fens     Array of count null-terminated FEN strings.
+  /// @param[in]  count    Number of positions.
+  /// @param[out] scores   Array of count scores in centipawns from white's point of view,
+  ///                      0 for positions that failed to parse.
+  /// @param[out] statuses Optional array of count per-position status codes, may be NULL.
+  /// @return     ICHESS_OK if all positions were evaluated, ICHESS_INVALID_ARGUMENT if fens or
+  ///             scores is NULL, or else the status of the first position that failed:
+  ///             ICHESS_INVALID_ARGUMENT for a NULL entry, ICHESS_INVALID_FEN or ICHESS_INTERNAL_ERROR.
+  ICHESS_API int ichess_evaluate_fens(const char* const* fens, size_t count, int* scores, int* statuses);
+
+  /// @brief      List the pseudo-legal moves of the side to move for many FEN positions in one call.
+  /// @param[in]  fens     Array of count null-terminated FEN strings.
+  /// @param[in]  count    Number of positions.
+  /// @param[out] moves    Buffer receiving the moves of all positions back to back.
+  ///                      May be NULL when capacity is 0.
+  /// @param[in]  capacity Number of moves the buffer can hold.
+  /// @param[out] offsets  Array of count + 1 entries. Moves of position i are
+  ///                      moves[offsets[i]] to moves[offsets[i + 1] - 1]; offsets[count] is the total.
+  /// @return     ICHESS_INVALID_ARGUMENT if a required pointer is NULL, ICHESS_BUFFER_TOO_SMALL
+  ///             if the total exceeds capacity (offsets still describe the full result so the
+  ///             caller can retry; this takes priority over failed positions), or else ICHESS_OK
+  ///             or the status of the first position that failed: ICHESS_INVALID_ARGUMENT for a
+  ///             NULL entry or ICHESS_INVALID_FEN. Failed positions get no moves. On
+  ///             ICHESS_INTERNAL_ERROR the remaining positions get no moves either.
+  /// @warning    Same limits as ichess_board_pseudo_legal_moves().
+  ICHESS_API int ichess_pseudo_legal_moves_fens(const char* const* fens,
+                                                size_t             count,
+                                                ichess_move*       moves,
+                                                size_t             capacity,
+                                                size_t*            offsets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ICHESS_SRC_ICHESS_H
@@ -0,0 +1,83 @@
+/// @file      pawn_hash.hpp
+/// @brief     Hash table caching pawn structure evaluation.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Defines the PawnHashTable class that stores pawn structure scores keyed
+///            by the pawn-only Zobrist key, together with hit-rate statistics.
+
+#ifndef ICHESS_SRC_PAWN_HASH
+#define ICHESS_SRC_PAWN_HASH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "evaluation.hpp"
+#include "zobrist.hpp"
+
+/// @class   PawnHashTable
+/// @brief   Direct-mapped cache of pawn structure scores.
+/// @details Pawn structure only changes on pawn moves and captures of pawns, so the score
+///          computed for a pawn key can be reused at every evaluation sharing that key.
+///          Each thread uses its own table through local(), so no locking is needed.
+class PawnHashTable
+{
+  public:
+    inline static constexpr std::size_t DEFAULT_SIZE = 4096; ///< Default entry count, must be a power of two
+
+    /// @brief   Construct a PawnHashTable.
+    /// @param   size Number of entries, rounded down to a power of two (at least 1).
+    /// @details All entries start empty and statistics start at zero.
+    explicit PawnHashTable(std::size_t size = DEFAULT_SIZE);
+
+    /// @brief      Look up the pawn structure score of a pawn key.
+    /// @param[in]  key   The pawn-only Zobrist key.
+    /// @param[out] score The cached score, only written on a hit.
+    /// @return     True if the key was found in the table.
+    /// @details    Every call counts as a probe; successful calls count as hits.
+    bool probe(const ZobristKey key, Score& score);
+
+    /// @brief Store the pawn structure score of a pawn key.
+    /// @param key   The pawn-only Zobrist key.
+    /// @param score The pawn structure score to cache.
+    /// @note  Replaces whatever entry previously used the same slot.
+    void store(const ZobristKey key, const Score& score);
+
+    /// @brief   Remove all entries and reset the statistics.
+    void clear();
+
+    /// @brief  Get the number of probes since construction or the last clear().
+    /// @return Probe count.
+    std::uint64_t getProbes() const;
+
+    /// @brief  Get the number of successful probes since construction or the last clear().
+    /// @return Hit count.
+    std::uint64_t getHits() const;
+
+    /// @brief  Get the fraction of probes that hit.
+    /// @return Hit rate in [0, 1], or 0 when nothing was probed.
+    double getHitRate() const;
+
+    /// @brief  Get the pawn hash table of the calling thread.
+    /// @return Reference to a table created on first use in each thread.
+    static PawnHashTable& local();
+
+  private:
+    /// @struct  PawnHashTable::Entry
+    /// @brief   One cached pawn structure score.
+    struct Entry
+    {
+        ZobristKey key   = 0;     ///< Pawn key the score belongs to
+        Score      score = {};    ///< Cached pawn structure score
+        bool       valid = false; ///< Whether the entry holds a stored score
+    };
+
+    std::vector<Entry> entries = {}; ///< Table slots, indexed by the low bits of the key
+    std::size_t        mask    = 0;  ///< Entry count minus one
+    std::uint64_t      probes  = 0;  ///< Number of probe() calls
+    std::uint64_t      hits    = 0;  ///< Number of probe() calls that found their key
+};
+
+#endif // ICHESS_SRC_PAWN_HASH
@@ -41,6 +41,30 @@ class Pawn : public Piece
                                  const Piece::PositionList& other_p,
                                  const Piece::ColorList&    other_c,
                                  const Properties&          props) const override;
+
+    /// @brief      Calculate capture-only moves for this pawn.
+    /// @param[out] p       Vector to be filled with valid capture positions.
+    /// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+    /// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
+    /// @param[in]  props   Properties of the board for move validation, used for en passant.
+    /// @throws     std::runtime_error if the piece has an invalid color.
+    /// @details    Covers diagonal captures and en passant captures only.
+    virtual void available_captures(Piece::PositionList&       p,
+                                    const Piece::PositionList& other_p,
+                                    const Piece::ColorList&    other_c,
+                                    const Properties&          props) const override;
+
+    /// @brief      Calculate quiet (non-capture) moves for this pawn.
+    /// @param[out] p       Vector to be filled with valid quiet move positions.
+    /// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+    /// @param[in]  other_c Vector of colors corresponding to each piece in other_p, unused for quiet moves.
+    /// @param[in]  props   Properties of the board for move validation, unused for quiet moves.
+    /// @throws     std::runtime_error if the piece has an invalid color.
+    /// @details    Covers the one and two squares forward moves only.
+    virtual void available_quiets(Piece::PositionList&       p,
+                                  const Piece::PositionList& other_p,
+                                  const Piece::ColorList&    other_c,
+                                  const Properties&          props) const override;
 };
 
 #endif // ICHESS_SRC_PAWNS
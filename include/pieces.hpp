@@ -101,6 +101,14 @@ class Piece
     /// @return Character representation (uppercase for white, lowercase for black).
     const char get_representation() const;
 
+    /// @brief  Get the type of the piece.
+    /// @return The piece type (PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING or NONE).
+    const Piece::Type get_type() const;
+
+    /// @brief  Get the color of the piece.
+    /// @return The piece color (WHITE, BLACK or NONE).
+    const Piece::Color get_color() const;
+
     /// @brief Virtual destructor for proper cleanup in derived classes.
     virtual ~Piece() = default;
 
@@ -124,6 +132,44 @@ class Piece
                                  const PositionList& other_p,
                                  const ColorList&    other_c,
                                  const Properties&   props) const = 0;
+
+    /// @brief      Calculate capture-only moves for this piece using Piece::List parameter.
+    /// @param[out] p     Vector to be filled with valid capture positions.
+    /// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
+    /// @param[in]  props Properties of the board for move validation.
+    /// @details    Extracts positions and colors from the List and calls the virtual overload.
+    void available_captures(PositionList& p, const List& other, const Properties& props) const;
+
+    /// @brief      Calculate capture-only moves for this piece.
+    /// @param[out] p       Vector to be filled with valid capture positions.
+    /// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+    /// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
+    /// @param[in]  props   Properties of the board for move validation.
+    /// @details    Default implementation keeps the moves of available_moves() that land on an occupied square.
+    ///             Derived classes may override it to skip generating moves that are discarded anyway.
+    virtual void available_captures(PositionList&       p,
+                                    const PositionList& other_p,
+                                    const ColorList&    other_c,
+                                    const Properties&   props) const;
+
+    /// @brief      Calculate quiet (non-capture) moves for this piece using Piece::List parameter.
+    /// @param[out] p     Vector to be filled with valid quiet move positions.
+    /// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
+    /// @param[in]  props Properties of the board for move validation.
+    /// @details    Extracts positions and colors from the List and calls the virtual overload.
+    void available_quiets(PositionList& p, const List& other, const Properties& props) const;
+
+    /// @brief      Calculate quiet (non-capture) moves for this piece.
+    /// @param[out] p       Vector to be filled with valid quiet move positions.
+    /// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+    /// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
+    /// @param[in]  props   Properties of the board for move validation.
+    /// @details    Default implementation keeps the moves of available_moves() that land on an empty square.
+    ///             Derived classes may override it to skip generating moves that are discarded anyway.
+    virtual void available_quiets(PositionList&       p,
+                                  const PositionList& other_p,
+                                  const ColorList&    other_c,
+                                  const Properties&   props) const;
 };
 
 /// @brief  Helper function to safely get the character representation of a piece pointer.
@@ -0,0 +1,46 @@
+/// @file      zobrist.hpp
+/// @brief     Zobrist hashing keys for board positions.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Declares the random keys used to hash piece placements incrementally.
+///            Keys are generated at compile time from a fixed seed, so hashes are
+///            reproducible across runs and platforms.
+
+#ifndef ICHESS_SRC_ZOBRIST
+#define ICHESS_SRC_ZOBRIST
+
+#include <cstdint>
+
+#include "common.hpp"
+#include "pieces.hpp"
+
+/// @brief A Zobrist hash of a board position or of part of it.
+using ZobristKey = std::uint64_t;
+
+/// @brief   Get the Zobrist key of a piece on a square.
+/// @param   type  The type of the piece.
+/// @param   color The color of the piece.
+/// @param   pos   The position of the piece on the board.
+/// @return  The key to XOR into a hash when the piece is placed or removed, or 0 for
+///          pieces without type or color and positions outside the board.
+ZobristKey zobrist_piece_key(const Piece::Type type, const Piece::Color color, const Position& pos);
+
+/// @brief   Get the Zobrist key of the castling rights.
+/// @param   props Board properties holding the king and rook moved flags.
+/// @return  XOR of one key per castling right still available, 0 when none is left.
+/// @details A right is available while neither the king nor the rook on that side has moved.
+ZobristKey zobrist_castling_key(const Properties& props);
+
+/// @brief  Get the Zobrist key of the side to move.
+/// @param  props Board properties holding the side to move.
+/// @return A fixed key when black is to move, 0 when white is to move.
+ZobristKey zobrist_side_key(const Properties& props);
+
+/// @brief  Get the Zobrist key of an en passant file.
+/// @param  file File of the pawn that can be captured en passant, 'a' through 'h'.
+/// @return One key per file, 0 for any other character such as ' ' when no capture is possible.
+ZobristKey zobrist_passant_key(const char file);
+
+#endif // ICHESS_SRC_ZOBRIST
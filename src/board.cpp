@@ -6,6 +6,10 @@
 /// @details   Provides implementation for piece management, grid updates, and
 ///            console-based board visualization using ASCII art.
 
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+
 #include "board.hpp"
 #include "pawns.hpp"
 #include "rook.hpp"
@@ -13,6 +17,7 @@
 #include "bishop.hpp"
 #include "queen.hpp"
 #include "king.hpp"
+#include "pawn_hash.hpp"
 
 /// @brief   Construct the Board.
 /// @details Initializes a new board with an empty grid.
@@ -53,19 +58,414 @@ void Board::updateGrid()
 
 /// @brief   Remove and delete all pieces from the board.
 /// @details Smart pointers automatically clean up memory when vector is cleared.
-void Board::cleanPieces() { pieces.clear(); }
+///          The evaluation running sums and the Zobrist keys are reset along with the pieces.
+void Board::cleanPieces()
+{
+  pieces.clear();
+  eval_score = {};
+  eval_phase = 0;
+  pawn_key   = 0;
+  piece_key  = 0;
+}
 
 /// @brief   Add a piece to the board.
 /// @param   piece Unique pointer to the Piece object to add. Ownership is transferred to Board class.
 /// @details The board takes ownership of the piece and will manage its lifetime.
-void Board::addPiece(std::unique_ptr<Piece> piece) { pieces.push_back(std::move(piece)); }
+///          The piece contribution is added to the evaluation running sums.
+void Board::addPiece(std::unique_ptr<Piece> piece)
+{
+  if (piece)
+  {
+    accumulateEvaluation(*piece, 1);
+  }
+  pieces.push_back(std::move(piece));
+}
+
+/// @brief   Add or remove the evaluation contribution of a piece to the running sums.
+/// @param   piece The piece whose material, piece-square value and phase are applied.
+/// @param   sign  +1 when the piece is placed, -1 when it is removed.
+/// @details Any code that moves, adds or removes pieces must call this once with -1 for the
+///          old placement and once with +1 for the new one, so evaluate() stays O(1).
+///          The piece also toggles its key in the piece key (and the pawn key for pawns),
+///          which does not depend on the sign.
+void Board::accumulateEvaluation(const Piece& piece, const int sign)
+{
+  char       f     = ' ', r = ' ';
+  Score      value = {};
+  ZobristKey key   = 0;
+  piece.get_position(f, r);
+  value = piece_square_value(piece.get_type(), piece.get_color(), {f, r});
+  key   = zobrist_piece_key(piece.get_type(), piece.get_color(), {f, r});
+  eval_score.mg += sign * value.mg;
+  eval_score.eg += sign * value.eg;
+  eval_phase += sign * piece_phase(piece.get_type());
+  piece_key ^= key;
+  if (piece.get_type() == Piece::Type::PAWN)
+  {
+    pawn_key ^= key;
+  }
+}
+
+/// @brief   Recompute the evaluation running sums from scratch.
+/// @details Walks all pieces once and rebuilds the sums used by evaluate().
+void Board::refreshEvaluation()
+{
+  eval_score = {};
+  eval_phase = 0;
+  pawn_key   = 0;
+  piece_key  = 0;
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p)
+    {
+      accumulateEvaluation(*p, 1);
+    }
+  }
+}
+
+/// @brief   Evaluate the current position statically.
+/// @return  Tapered material and piece-square score in centipawns from white's point of view.
+/// @details Blends the midgame and endgame running sums, plus the cached pawn structure
+///          score, by the running game phase.
+int Board::evaluate() const { return taper(eval_score + evaluatePawnStructure(), eval_phase); }
+
+/// @brief   Check whether a single move is pseudo-legal on the board.
+/// @details A first pass over the pieces finds the moving piece and the occupant of the end
+///          position without copying anything, so most illegal requests are rejected early.
+///          Only then are positions and colors collected for the moving piece's generator,
+///          into per-thread buffers that keep their capacity between calls.
+bool Board::isLegal(const Move& move) const
+{
+  if (!is_in_grid_range(move.start) || !is_in_grid_range(move.end) || move.start == move.end)
+  {
+    return false;
+  }
+
+  const Piece* moving = nullptr;
+  const Piece* target = nullptr;
+
+  char f = ' ', r = ' ';
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p)
+    {
+      p->get_position(f, r);
+      if (move.start == Position{f, r})
+      {
+        moving = p.get();
+      }
+      else if (move.end == Position{f, r})
+      {
+        target = p.get();
+      }
+    }
+  }
+
+  if (!moving || moving->is_white() != state.white_to_move || moving->get_color() == Piece::Color::NONE)
+  {
+    return false;
+  }
+  if (target && target->get_color() == moving->get_color())
+  {
+    return false;
+  }
+
+  static thread_local Piece::PositionList other_p = {};
+  static thread_local Piece::ColorList    other_c = {};
+  static thread_local Piece::PositionList moves   = {};
+
+  other_p.clear();
+  other_c.clear();
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p)
+    {
+      p->get_position(f, r);
+      other_p.push_back({f, r});
+      other_c.push_back(p->get_color());
+    }
+  }
+
+  if (target)
+  {
+    moving->available_captures(moves, other_p, other_c, state);
+  }
+  else
+  {
+    moving->available_moves(moves, other_p, other_c, state);
+  }
+  return moves.end() != std::find(moves.begin(), moves.end(), move.end);
+}
+
+/// @brief      Generate the moves of the side to move.
+/// @param[out] moves Vector to be filled with the moves of all pieces of the side to move.
+void Board::availableMoves(std::vector<Move>& moves) const
+{
+  Piece::PositionList other_p     = {};
+  Piece::ColorList    other_c     = {};
+  Piece::PositionList piece_moves = {};
+  const Piece::Color  side        = state.white_to_move ? Piece::Color::WHITE : Piece::Color::BLACK;
+
+  char f = ' ', r = ' ';
+  moves.clear();
+  other_p.reserve(pieces.size());
+  other_c.reserve(pieces.size());
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p)
+    {
+      p->get_position(f, r);
+      other_p.push_back({f, r});
+      other_c.push_back(p->get_color());
+    }
+  }
+
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p && p->get_color() == side)
+    {
+      p->get_position(f, r);
+      p->available_moves(piece_moves, other_p, other_c, state);
+      for (const Position& target : piece_moves)
+      {
+        moves.push_back({{f, r}, target});
+      }
+    }
+  }
+}
+
+/// @brief  Create a piece from its FEN letter.
+/// @param  letter FEN piece letter, uppercase for white and lowercase for black.
+/// @param  file   The file (column) coordinate ('a' to 'h').
+/// @param  rank   The rank (row) coordinate ('1' to '8').
+/// @return Unique pointer to the new piece, or nullptr if the letter is not a piece.
+static std::unique_ptr<Piece> make_piece(const char letter, const char file, const char rank)
+{
+  Piece::Color           color = std::isupper(static_cast<unsigned char>(letter)) ? Piece::Color::WHITE
+                                                                                    : Piece::Color::BLACK;
+  std::unique_ptr<Piece> piece = nullptr;
+  switch (std::toupper(static_cast<unsigned char>(letter)))
+  {
+  case 'P':
+    piece = std::make_unique<Pawn>(file, rank, color);
+    break;
+  case 'N':
+    piece = std::make_unique<Knight>(file, rank, color);
+    break;
+  case 'B':
+    piece = std::make_unique<Bishop>(file, rank, color);
+    break;
+  case 'R':
+    piece = std::make_unique<Rook>(file, rank, color);
+    break;
+  case 'Q':
+    piece = std::make_unique<Queen>(file, rank, color);
+    break;
+  case 'K':
+    piece = std::make_unique<King>(file, rank, color);
+    break;
+  default:
+    break;
+  }
+  return piece;
+}
+
+/// @brief  Check whether a FEN field is a move counter.
+/// @param  field The field to check.
+/// @return True for a non-negative decimal integer small enough to fit an int.
+static bool is_fen_counter(const std::string& field)
+{
+  return !field.empty() && field.size() <= 9
+         && std::all_of(field.begin(), field.end(), [](const char c) { return '0' <= c && c <= '9'; });
+}
+
+/// @brief  Check whether a FEN field holds valid castling rights.
+/// @param  field The field to check.
+/// @return True for "-" or a non-empty subset of "KQkq" without repeated letters.
+static bool is_fen_castling(const std::string& field)
+{
+  if (field == "-")
+  {
+    return true;
+  }
+  if (field.empty() || field.size() > 4)
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < field.size(); i++)
+  {
+    if (std::string("KQkq").find(field[i]) == std::string::npos || field.find(field[i], i + 1) != std::string::npos)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief   Set up the board from a position in Forsyth-Edwards Notation.
+/// @param   fen The FEN string.
+/// @throws  std::invalid_argument if the FEN cannot be parsed.
+/// @details Parses everything into local variables first, so a bad FEN leaves the board untouched.
+void Board::loadFen(const std::string& fen)
+{
+  std::istringstream stream(fen);
+  std::string        placement, side = "w", castling = "-", passant = "-", halfmove = "0", fullmove = "1", extra;
+  Piece::List        parsed = {};
+  Properties         props  = default_properties;
+  char               file   = 'a';
+  char               rank   = '8';
+
+  if (!(stream >> placement))
+  {
+    throw std::invalid_argument("Empty FEN");
+  }
+  stream >> side >> castling >> passant >> halfmove >> fullmove;
+  if (stream >> extra)
+  {
+    throw std::invalid_argument("Unexpected text after FEN fields: " + fen);
+  }
+  if (!is_fen_counter(halfmove) || !is_fen_counter(fullmove))
+  {
+    throw std::invalid_argument("Invalid FEN move counter: " + fen);
+  }
+
+  // Piece placement, from a8 to h1
+  for (const char c : placement)
+  {
+    if (c == '/')
+    {
+      if (file != 'a' + BOARD_SIZE || rank == '1')
+      {
+        throw std::invalid_argument("Invalid FEN rank: " + fen);
+      }
+      file = 'a';
+      rank--;
+    }
+    else if ('1' <= c && c <= '8')
+    {
+      file += c - '0';
+    }
+    else
+    {
+      std::unique_ptr<Piece> piece = make_piece(c, file, rank);
+      if (!piece || file >= 'a' + BOARD_SIZE)
+      {
+        throw std::invalid_argument("Invalid FEN piece placement: " + fen);
+      }
+      parsed.push_back(std::move(piece));
+      file++;
+    }
+    if (file > 'a' + BOARD_SIZE)
+    {
+      throw std::invalid_argument("Invalid FEN rank: " + fen);
+    }
+  }
+  if (file != 'a' + BOARD_SIZE || rank != '1')
+  {
+    throw std::invalid_argument("Incomplete FEN piece placement: " + fen);
+  }
+
+  // Side to move
+  if (side != "w" && side != "b")
+  {
+    throw std::invalid_argument("Invalid FEN side to move: " + fen);
+  }
+  props.white_to_move = (side == "w");
+
+  // Castling rights, a missing right is stored as a moved rook
+  if (!is_fen_castling(castling))
+  {
+    throw std::invalid_argument("Invalid FEN castling rights: " + fen);
+  }
+  props.white_rook_king_side_has_moved  = (castling.find('K') == std::string::npos);
+  props.white_rook_queen_side_has_moved = (castling.find('Q') == std::string::npos);
+  props.black_rook_king_side_has_moved  = (castling.find('k') == std::string::npos);
+  props.black_rook_queen_side_has_moved = (castling.find('q') == std::string::npos);
+
+  // En passant square, stored as the double step that allows it; it lies behind a pawn of the side not to move
+  if (passant != "-")
+  {
+    char passant_rank = props.white_to_move ? '6' : '3';
+    if (passant.size() != 2 || passant[0] < 'a' || passant[0] > 'h' || passant[1] != passant_rank)
+    {
+      throw std::invalid_argument("Invalid FEN en passant square: " + fen);
+    }
+    int direction         = props.white_to_move ? -1 : 1;
+    props.last_move_start = {passant[0], static_cast<char>(passant[1] - direction)};
+    props.last_move_end   = {passant[0], static_cast<char>(passant[1] + direction)};
+  }
+  props.halfmove_clock        = std::stoi(halfmove);
+  props.turns_since_pawn_move = (passant != "-") ? 0 : props.halfmove_clock;
+
+  cleanPieces();
+  clearGrid();
+  clearHistory();
+  reservePieces(parsed.size());
+  for (std::unique_ptr<Piece>& piece : parsed)
+  {
+    addPiece(std::move(piece));
+  }
+  state = props;
+  updateGrid();
+}
+
+/// @brief  Get the Zobrist key of the pawn placement.
+/// @return XOR of the keys of all pawns on the board.
+ZobristKey Board::getPawnKey() const { return pawn_key; }
+
+/// @brief   Get the pawn structure score of the current pawn placement.
+/// @details On a pawn hash miss, marks pawn positions per color on fixed-size grids, computes
+///          the score and stores it for the next evaluation with the same pawns.
+Score Board::evaluatePawnStructure() const
+{
+  PawnHashTable& table = PawnHashTable::local();
+  Score          score = {};
+  if (!table.probe(pawn_key, score))
+  {
+    PawnGrid white_pawns = {};
+    PawnGrid black_pawns = {};
+
+    char f = ' ', r = ' ';
+    for (const std::unique_ptr<Piece>& p : pieces)
+    {
+      if (p && p->get_type() == Piece::Type::PAWN)
+      {
+        p->get_position(f, r);
+        if (!is_in_grid_range({f, r}))
+        {
+          continue;
+        }
+        if (p->is_white())
+        {
+          white_pawns[f - 'a'][r - '1'] = true;
+        }
+        else if (p->is_black())
+        {
+          black_pawns[f - 'a'][r - '1'] = true;
+        }
+      }
+    }
+    score = pawn_grid_structure(white_pawns, black_pawns);
+    table.store(pawn_key, score);
+  }
+  return score;
+}
+
+/// @brief   Reserve room for pieces in the pieces container.
+/// @param   count Number of pieces the board should hold without reallocating.
+void Board::reservePieces(const std::size_t count) { pieces.reserve(count); }
 
 /// @brief   Initialize the board with standard chess starting position.
-/// @details Creates white pieces on rank 1 and 2 and black pieces on rank 7 and 8.
+/// @details Removes previous pieces, properties and history, so a reused board does not keep
+///          them, then creates white pieces on rank 1 and 2 and black pieces on rank 7 and 8.
 ///          Updates the grid representation after placing pieces.
 void Board::initializeStandardSetup()
 {
+  cleanPieces();
+  reservePieces(STANDARD_PIECE_COUNT);
   clearGrid();
+  clearHistory();
+  setProperties(default_properties);
   for (int i = 0; i < BOARD_SIZE; i++)
   {
     addPiece(std::make_unique<Pawn>('a' + i, '2', Piece::Color::WHITE));
@@ -117,3 +517,157 @@ void Board::display() const
   std::cout << std::endl << "  +---+---+---+---+---+---+---+---+" << std::endl;
   std::cout << "    a   b   c   d   e   f   g   h" << std::endl << std::endl;
 }
+
+/// @brief  Get the Zobrist key of the current position.
+/// @return Running piece key combined with the keys of the castling rights, side to move and
+///         en passant file.
+ZobristKey Board::getPositionKey() const
+{
+  return piece_key ^ zobrist_castling_key(state) ^ zobrist_side_key(state) ^ zobrist_passant_key(passantFile());
+}
+
+/// @brief   Get the file on which the side to move can capture en passant.
+/// @details Only looks at the pieces right after a double pawn step, then checks that the pawn
+///          that moved is still there and that a pawn of the side to move stands next to it.
+char Board::passantFile() const
+{
+  const Position&    end    = state.last_move_end;
+  const Piece::Color mover  = state.white_to_move ? Piece::Color::WHITE : Piece::Color::BLACK;
+  const char         rank   = state.white_to_move ? '5' : '4';
+  bool               pushed = false;
+  bool               beside = false;
+
+  if (state.turns_since_pawn_move != 0 || end.rank != rank || state.last_move_start.file != end.file
+      || state.last_move_start.rank != rank + (state.white_to_move ? 2 : -2))
+  {
+    return ' ';
+  }
+
+  char f = ' ', r = ' ';
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (p && p->get_type() == Piece::Type::PAWN)
+    {
+      p->get_position(f, r);
+      if (r != rank)
+      {
+        continue;
+      }
+      if (f == end.file && p->get_color() != mover && p->get_color() != Piece::Color::NONE)
+      {
+        pushed = true;
+      }
+      else if ((f == end.file - 1 || f == end.file + 1) && p->get_color() == mover)
+      {
+        beside = true;
+      }
+    }
+  }
+  return (pushed && beside) ? end.file : ' ';
+}
+
+/// @brief  Get the state properties of the board.
+/// @return Reference to the current properties.
+const Properties& Board::getProperties() const { return state; }
+
+/// @brief Replace the state properties of the board.
+/// @param props The new properties.
+void Board::setProperties(const Properties& props) { state = props; }
+
+/// @brief Record the current position in the game history.
+void Board::pushHistory() { key_history.push_back(getPositionKey()); }
+
+/// @brief Drop the most recent position from the game history.
+void Board::popHistory()
+{
+  if (!key_history.empty())
+  {
+    key_history.pop_back();
+  }
+}
+
+/// @brief Forget all recorded positions.
+void Board::clearHistory() { key_history.clear(); }
+
+/// @brief   Count earlier occurrences of the current position.
+/// @details Entry size - d of the history is the position d plies ago. Only even distances
+///          have the same side to move, and distances beyond the halfmove clock are skipped.
+int Board::countRepetitions() const
+{
+  const ZobristKey key      = getPositionKey();
+  const int        size     = static_cast<int>(key_history.size());
+  const int        distance = std::min(state.halfmove_clock, size);
+  int              count    = 0;
+  for (int d = 2; d <= distance; d += 2)
+  {
+    if (key_history[size - d] == key)
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+/// @brief  Check for a repetition inside the search tree.
+/// @return True if the current position occurred at least once before.
+bool Board::isRepetition() const { return countRepetitions() >= 1; }
+
+/// @brief  Check for a threefold repetition.
+/// @return True if the current position occurred at least twice before.
+bool Board::isThreefoldRepetition() const { return countRepetitions() >= 2; }
+
+/// @brief  Check for the fifty-move rule.
+/// @return True if the halfmove clock reached 100 plies.
+bool Board::isFiftyMoveDraw() const { return state.halfmove_clock >= 100; }
+
+/// @brief   Check whether neither side can deliver checkmate.
+/// @details Any pawn makes mate possible, which the pawn key tells without walking the pieces.
+///          Otherwise stops at the first rook or queen and counts the minor pieces.
+bool Board::hasInsufficientMaterial() const
+{
+  if (pawn_key != 0)
+  {
+    return false;
+  }
+
+  int  knights      = 0;
+  int  bishops      = 0;
+  bool light_bishop = false;
+  bool dark_bishop  = false;
+
+  char f = ' ', r = ' ';
+  for (const std::unique_ptr<Piece>& p : pieces)
+  {
+    if (!p)
+    {
+      continue;
+    }
+    switch (p->get_type())
+    {
+    case Piece::Type::KNIGHT:
+      knights++;
+      break;
+    case Piece::Type::BISHOP:
+      bishops++;
+      p->get_position(f, r);
+      if ((f - 'a' + r - '1') % 2 == 0)
+      {
+        dark_bishop = true;
+      }
+      else
+      {
+        light_bishop = true;
+      }
+      break;
+    case Piece::Type::KING:
+      break;
+    default:
+      return false;
+    }
+  }
+  return (knights + bishops <= 1) || (knights == 0 && !(light_bishop && dark_bishop));
+}
+
+/// @brief  Check all draw rules that do not need move generation.
+/// @return True if any of the draw rules applies.
+bool Board::isDraw() const { return isFiftyMoveDraw() || isThreefoldRepetition() || hasInsufficientMaterial(); }
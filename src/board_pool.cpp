@@ -0,0 +1,76 @@
+/// @file      board_pool.cpp
+/// @brief     Implementation of the pool of recycled Board instances.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @details   Provides preallocation, hand-out and reset of pooled boards.
+
+#include <functional>
+#include <stdexcept>
+
+#include "board_pool.hpp"
+
+/// @brief   Construct a BoardPool.
+/// @details Allocates all boards up front in one array and marks them as available.
+BoardPool::BoardPool(std::size_t size) : boards(std::make_unique<Board[]>(size)), board_count(size), in_use(size, false)
+{
+  free_list.reserve(size);
+  for (std::size_t i = 0; i < size; i++)
+  {
+    boards[i].reservePieces(STANDARD_PIECE_COUNT);
+    free_list.push_back(&boards[i]);
+  }
+}
+
+/// @brief  Take a board out of the pool.
+/// @return Pointer to an empty board, or nullptr if all boards are in use.
+Board* BoardPool::acquire()
+{
+  Board* board = nullptr;
+  if (!free_list.empty())
+  {
+    board = free_list.back();
+    free_list.pop_back();
+    in_use[board - boards.get()] = true;
+  }
+  return board;
+}
+
+/// @brief   Return a board to the pool.
+/// @throws  std::invalid_argument if the board does not belong to this pool or is not in use.
+/// @details The boards are contiguous, so ownership and the index of the in-use flag follow
+///          from the address. Clearing keeps the capacity of the piece container, so a recycled
+///          board does not reallocate it when the next game is set up.
+void BoardPool::release(Board* board)
+{
+  if (!board)
+  {
+    return;
+  }
+
+  const std::less<const Board*> before = {};
+  if (before(board, boards.get()) || !before(board, boards.get() + board_count))
+  {
+    throw std::invalid_argument("Board does not belong to this pool");
+  }
+  const std::size_t index = board - boards.get();
+  if (!in_use[index])
+  {
+    throw std::invalid_argument("Board released while not in use");
+  }
+
+  board->cleanPieces();
+  board->clearGrid();
+  board->clearHistory();
+  board->setProperties(default_properties);
+  in_use[index] = false;
+  free_list.push_back(board);
+}
+
+/// @brief  Get the number of boards owned by the pool.
+/// @return Total board count.
+std::size_t BoardPool::size() const { return board_count; }
+
+/// @brief  Get the number of boards ready to be acquired.
+/// @return Count of boards not in use.
+std::size_t BoardPool::available() const { return free_list.size(); }
@@ -0,0 +1,327 @@
+/// @file      evaluation.cpp
+/// @brief     Implementation of the material and piece-square-table evaluation terms.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @details   Provides piece values, game phase weights and piece-square tables.
+///            Tables are indexed from a8 (index 0) to h1 (index 63) from white's point of view.
+
+#include <array>
+
+#include "evaluation.hpp"
+
+/// @brief A piece-square table, one centipawn bonus per square.
+using SquareTable = std::array<int, 64>;
+
+// clang-format off
+static constexpr SquareTable pawn_table = {
+   0,   0,   0,   0,   0,   0,   0,   0,
+  50,  50,  50,  50,  50,  50,  50,  50,
+  10,  10,  20,  30,  30,  20,  10,  10,
+   5,   5,  10,  25,  25,  10,   5,   5,
+   0,   0,   0,  20,  20,   0,   0,   0,
+   5,  -5, -10,   0,   0, -10,  -5,   5,
+   5,  10,  10, -20, -20,  10,  10,   5,
+   0,   0,   0,   0,   0,   0,   0,   0};
+
+static constexpr SquareTable knight_table = {
+ -50, -40, -30, -30, -30, -30, -40, -50,
+ -40, -20,   0,   0,   0,   0, -20, -40,
+ -30,   0,  10,  15,  15,  10,   0, -30,
+ -30,   5,  15,  20,  20,  15,   5, -30,
+ -30,   0,  15,  20,  20,  15,   0, -30,
+ -30,   5,  10,  15,  15,  10,   5, -30,
+ -40, -20,   0,   5,   5,   0, -20, -40,
+ -50, -40, -30, -30, -30, -30, -40, -50};
+
+static constexpr SquareTable bishop_table = {
+ -20, -10, -10, -10, -10, -10, -10, -20,
+ -10,   0,   0,   0,   0,   0,   0, -10,
+ -10,   0,   5,  10,  10,   5,   0, -10,
+ -10,   5,   5,  10,  10,   5,   5, -10,
+ -10,   0,  10,  10,  10,  10,   0, -10,
+ -10,  10,  10,  10,  10,  10,  10, -10,
+ -10,   5,   0,   0,   0,   0,   5, -10,
+ -20, -10, -10, -10, -10, -10, -10, -20};
+
+static constexpr SquareTable rook_table = {
+   0,   0,   0,   0,   0,   0,   0,   0,
+   5,  10,  10,  10,  10,  10,  10,   5,
+  -5,   0,   0,   0,   0,   0,   0,  -5,
+  -5,   0,   0,   0,   0,   0,   0,  -5,
+  -5,   0,   0,   0,   0,   0,   0,  -5,
+  -5,   0,   0,   0,   0,   0,   0,  -5,
+  -5,   0,   0,   0,   0,   0,   0,  -5,
+   0,   0,   0,   5,   5,   0,   0,   0};
+
+static constexpr SquareTable queen_table = {
+ -20, -10, -10,  -5,  -5, -10, -10, -20,
+ -10,   0,   0,   0,   0,   0,   0, -10,
+ -10,   0,   5,   5,   5,   5,   0, -10,
+  -5,   0,   5,   5,   5,   5,   0,  -5,
+   0,   0,   5,   5,   5,   5,   0,  -5,
+ -10,   5,   5,   5,   5,   5,   0, -10,
+ -10,   0,   5,   0,   0,   0,   0, -10,
+ -20, -10, -10,  -5,  -5, -10, -10, -20};
+
+static constexpr SquareTable king_mg_table = {
+ -30, -40, -40, -50, -50, -40, -40, -30,
+ -30, -40, -40, -50, -50, -40, -40, -30,
+ -30, -40, -40, -50, -50, -40, -40, -30,
+ -30, -40, -40, -50, -50, -40, -40, -30,
+ -20, -30, -30, -40, -40, -30, -30, -20,
+ -10, -20, -20, -20, -20, -20, -20, -10,
+  20,  20,   0,   0,   0,   0,  20,  20,
+  20,  30,  10,   0,   0,  10,  30,  20};
+
+static constexpr SquareTable king_eg_table = {
+ -50, -40, -30, -20, -20, -30, -40, -50,
+ -30, -20, -10,   0,   0, -10, -20, -30,
+ -30, -10,  20,  30,  30,  20, -10, -30,
+ -30, -10,  30,  40,  40,  30, -10, -30,
+ -30, -10,  30,  40,  40,  30, -10, -30,
+ -30, -10,  20,  30,  30,  20, -10, -30,
+ -30, -30,   0,   0,   0,   0, -30, -30,
+ -50, -30, -30, -30, -30, -30, -30, -50};
+// clang-format on
+
+static constexpr Score doubled_pawn_penalty  = {-10, -20}; ///< Per extra pawn on a file
+static constexpr Score isolated_pawn_penalty = {-10, -15}; ///< Per pawn without friendly pawns on adjacent files
+static constexpr Score backward_pawn_penalty = {-8, -10};  ///< Per pawn left behind with a controlled stop square
+
+/// @brief Passed pawn bonus by relative rank (0 = own back rank, 7 = promotion rank).
+static constexpr std::array<Score, 8> passed_pawn_bonus = {
+  Score{0, 0}, Score{5, 10}, Score{10, 20}, Score{15, 30}, Score{25, 50}, Score{40, 80}, Score{60, 120}, Score{0, 0}};
+
+/// @brief  Fill a pawn grid from a list of pawn positions.
+/// @param  pawns Positions of the pawns.
+/// @return The occupancy grid indexed by file and rank.
+static PawnGrid make_pawn_grid(const Piece::PositionList& pawns)
+{
+  PawnGrid grid = {};
+  for (const Position& pos : pawns)
+  {
+    if (is_in_grid_range(pos))
+    {
+      grid[pos.file - 'a'][pos.rank - '1'] = true;
+    }
+  }
+  return grid;
+}
+
+/// @brief  Mirror the ranks of a pawn grid.
+/// @param  grid Occupancy grid indexed by file and rank.
+/// @return The same pawns seen from black's side, so black pawns advance towards higher ranks.
+static PawnGrid flip_ranks(const PawnGrid& grid)
+{
+  PawnGrid flipped = {};
+  for (int file = 0; file < 8; file++)
+  {
+    for (int rank = 0; rank < 8; rank++)
+    {
+      flipped[file][7 - rank] = grid[file][rank];
+    }
+  }
+  return flipped;
+}
+
+/// @brief  Evaluate the pawn structure of one side.
+/// @param  own      Grid of the side to evaluate, advancing towards higher relative ranks.
+/// @param  opponent Grid of the other side, in the same relative ranks as own.
+/// @return Pawn structure score of the own side.
+static Score side_pawn_structure(const PawnGrid& own, const PawnGrid& opponent)
+{
+  Score score = {};
+  for (int file = 0; file < 8; file++)
+  {
+    int count = 0;
+    for (int rank = 0; rank < 8; rank++)
+    {
+      if (!own[file][rank])
+      {
+        continue;
+      }
+      count++;
+
+      bool isolated = true;
+      bool passed   = true;
+      bool backward = true;
+      for (int adjacent = file - 1; adjacent <= file + 1; adjacent++)
+      {
+        if (adjacent < 0 || adjacent > 7)
+        {
+          continue;
+        }
+        for (int r = 0; r < 8; r++)
+        {
+          if (adjacent != file && own[adjacent][r])
+          {
+            isolated = false;
+            backward = backward && (r > rank);
+          }
+          passed = passed && !(r > rank && opponent[adjacent][r]);
+        }
+      }
+
+      // The stop square is controlled when an opponent pawn stands two ranks ahead on an adjacent file.
+      bool stop_controlled = rank + 2 < 8
+                             && ((file > 0 && opponent[file - 1][rank + 2])
+                                 || (file < 7 && opponent[file + 1][rank + 2]));
+      if (isolated)
+      {
+        score = score + isolated_pawn_penalty;
+      }
+      else if (backward && stop_controlled)
+      {
+        score = score + backward_pawn_penalty;
+      }
+      if (passed)
+      {
+        score = score + passed_pawn_bonus[rank];
+      }
+    }
+    for (int extra = 1; extra < count; extra++)
+    {
+      score = score + doubled_pawn_penalty;
+    }
+  }
+  return score;
+}
+
+/// @brief  Evaluate the pawn structure of both sides.
+/// @param  white_pawns Occupancy grid of all white pawns.
+/// @param  black_pawns Occupancy grid of all black pawns.
+/// @return Pawn structure score, positive when white's structure is better.
+Score pawn_grid_structure(const PawnGrid& white_pawns, const PawnGrid& black_pawns)
+{
+  return side_pawn_structure(white_pawns, black_pawns)
+         - side_pawn_structure(flip_ranks(black_pawns), flip_ranks(white_pawns));
+}
+
+/// @brief  Evaluate the pawn structure of both sides.
+/// @param  white_pawns Positions of all white pawns.
+/// @param  black_pawns Positions of all black pawns.
+/// @return Pawn structure score, positive when white's structure is better.
+Score pawn_structure(const Piece::PositionList& white_pawns, const Piece::PositionList& black_pawns)
+{
+  return pawn_grid_structure(make_pawn_grid(white_pawns), make_pawn_grid(black_pawns));
+}
+
+/// @brief  Get the material value of a piece type.
+/// @param  type The type of the piece.
+/// @return Midgame and endgame value in centipawns, zero for Piece::Type::NONE.
+Score piece_value(const Piece::Type type)
+{
+  Score value = {};
+  switch (type)
+  {
+  case Piece::Type::PAWN:
+    value = {82, 94};
+    break;
+  case Piece::Type::KNIGHT:
+    value = {337, 281};
+    break;
+  case Piece::Type::BISHOP:
+    value = {365, 297};
+    break;
+  case Piece::Type::ROOK:
+    value = {477, 512};
+    break;
+  case Piece::Type::QUEEN:
+    value = {1025, 936};
+    break;
+  default:
+    break;
+  }
+  return value;
+}
+
+/// @brief  Get the game phase weight of a piece type.
+/// @param  type The type of the piece.
+/// @return 1 for knights and bishops, 2 for rooks, 4 for queens and 0 otherwise.
+int piece_phase(const Piece::Type type)
+{
+  int phase = 0;
+  switch (type)
+  {
+  case Piece::Type::KNIGHT:
+  case Piece::Type::BISHOP:
+    phase = 1;
+    break;
+  case Piece::Type::ROOK:
+    phase = 2;
+    break;
+  case Piece::Type::QUEEN:
+    phase = 4;
+    break;
+  default:
+    break;
+  }
+  return phase;
+}
+
+/// @brief   Get the full evaluation contribution of a piece on a square.
+/// @param   type  The type of the piece.
+/// @param   color The color of the piece.
+/// @param   pos   The position of the piece on the board.
+/// @return  Material plus piece-square value, positive for white and negative for black.
+/// @details Black pieces look up the rank-mirrored square so both sides share the same tables.
+Score piece_square_value(const Piece::Type type, const Piece::Color color, const Position& pos)
+{
+  Score value = {};
+  if (!is_in_grid_range(pos) || color == Piece::Color::NONE)
+  {
+    return value;
+  }
+
+  int row    = (color == Piece::Color::WHITE) ? ('8' - pos.rank) : (pos.rank - '1');
+  int square = row * 8 + (pos.file - 'a');
+
+  value = piece_value(type);
+  switch (type)
+  {
+  case Piece::Type::PAWN:
+    value = value + Score{pawn_table[square], pawn_table[square]};
+    break;
+  case Piece::Type::KNIGHT:
+    value = value + Score{knight_table[square], knight_table[square]};
+    break;
+  case Piece::Type::BISHOP:
+    value = value + Score{bishop_table[square], bishop_table[square]};
+    break;
+  case Piece::Type::ROOK:
+    value = value + Score{rook_table[square], rook_table[square]};
+    break;
+  case Piece::Type::QUEEN:
+    value = value + Score{queen_table[square], queen_table[square]};
+    break;
+  case Piece::Type::KING:
+    value = value + Score{king_mg_table[square], king_eg_table[square]};
+    break;
+  default:
+    break;
+  }
+
+  if (color == Piece::Color::BLACK)
+  {
+    value = Score{} - value;
+  }
+  return value;
+}
+
+/// @brief  Blend a midgame/endgame score by the game phase.
+/// @param  score The accumulated midgame and endgame terms.
+/// @param  phase The game phase, clamped to [0, MAX_GAME_PHASE].
+/// @return The tapered score in centipawns.
+int taper(const Score& score, int phase)
+{
+  if (phase > MAX_GAME_PHASE)
+  {
+    phase = MAX_GAME_PHASE;
+  }
+  else if (phase < 0)
+  {
+    phase = 0;
+  }
+  return (score.mg * phase + score.eg * (MAX_GAME_PHASE - phase)) / MAX_GAME_PHASE;
+}
@@ -0,0 +1,264 @@
+/// @file      ichess.cpp
+/// @brief     Implementation of the C interface of the engine.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @details   Wraps Board behind the opaque ichess_board handle. No C++ exception
+///            crosses the boundary; errors are reported as ichess_status codes.
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include "ichess.h"
+#include "board.hpp"
+
+/// @struct  ichess_board
+/// @brief   Board instance behind the opaque C handle.
+struct ichess_board
+{
+    Board board; ///< The wrapped board
+};
+
+/// @brief  Convert a C move to an engine move.
+/// @param  move The C move.
+/// @return The same move as a Move.
+static Move to_move(const ichess_move& move)
+{
+  return {{move.start_file, move.start_rank}, {move.end_file, move.end_rank}};
+}
+
+/// @brief  Convert an engine move to a C move.
+/// @param  move The engine move.
+/// @return The same move as an ichess_move.
+static ichess_move to_c_move(const Move& move)
+{
+  return {move.start.file, move.start.rank, move.end.file, move.end.rank};
+}
+
+/// @brief  Load a FEN string into a board without letting exceptions escape.
+/// @param  board The board to set up.
+/// @param  fen   Null-terminated FEN string, must not be NULL.
+/// @return ICHESS_OK, ICHESS_INVALID_FEN or ICHESS_INTERNAL_ERROR.
+static int load_fen(Board& board, const char* fen)
+{
+  int status = ICHESS_OK;
+  try
+  {
+    board.loadFen(fen);
+  }
+  catch (const std::invalid_argument&)
+  {
+    status = ICHESS_INVALID_FEN;
+  }
+  catch (...)
+  {
+    status = ICHESS_INTERNAL_ERROR;
+  }
+  return status;
+}
+
+/// @brief  Create an empty board.
+/// @return Handle to the new board, or NULL if allocation failed.
+ichess_board* ichess_board_create(void) { return new (std::nothrow) ichess_board(); }
+
+/// @brief Destroy a board created by ichess_board_create().
+void ichess_board_destroy(ichess_board* board) { delete board; }
+
+/// @brief  Set up the standard starting position.
+/// @return ICHESS_OK or an error status.
+int ichess_board_standard_setup(ichess_board* board)
+{
+  if (!board)
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  try
+  {
+    board->board.initializeStandardSetup();
+  }
+  catch (...)
+  {
+    return ICHESS_INTERNAL_ERROR;
+  }
+  return ICHESS_OK;
+}
+
+/// @brief  Set up a position from a FEN string.
+/// @return ICHESS_OK or an error status.
+int ichess_board_load_fen(ichess_board* board, const char* fen)
+{
+  if (!board || !fen)
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  return load_fen(board->board, fen);
+}
+
+/// @brief   List the pseudo-legal moves of the side to move.
+/// @details Moves beyond capacity are counted but not written.
+int ichess_board_pseudo_legal_moves(const ichess_board* board, ichess_move* moves, size_t capacity, size_t* count)
+{
+  if (!board || !count || (!moves && capacity > 0))
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  std::vector<Move> found;
+  try
+  {
+    board->board.availableMoves(found);
+  }
+  catch (...)
+  {
+    return ICHESS_INTERNAL_ERROR;
+  }
+  *count = found.size();
+  for (size_t i = 0; i < found.size() && i < capacity; i++)
+  {
+    moves[i] = to_c_move(found[i]);
+  }
+  return (found.size() > capacity) ? ICHESS_BUFFER_TOO_SMALL : ICHESS_OK;
+}
+
+/// @brief  Check whether a single move is pseudo-legal.
+/// @return 1 if the move is pseudo-legal, 0 if not, or an error status.
+int ichess_board_is_pseudo_legal(const ichess_board* board, ichess_move move)
+{
+  if (!board)
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  try
+  {
+    return board->board.isLegal(to_move(move)) ? 1 : 0;
+  }
+  catch (...)
+  {
+    return ICHESS_INTERNAL_ERROR;
+  }
+}
+
+/// @brief  Evaluate the position statically.
+/// @return ICHESS_OK or an error status.
+int ichess_board_evaluate(const ichess_board* board, int* score)
+{
+  if (!board || !score)
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  try
+  {
+    *score = board->board.evaluate();
+  }
+  catch (...)
+  {
+    return ICHESS_INTERNAL_ERROR;
+  }
+  return ICHESS_OK;
+}
+
+/// @brief      Evaluate a board without letting exceptions escape.
+/// @param[in]  board The board to evaluate.
+/// @param[out] score Score in centipawns from white's point of view, 0 on error.
+/// @return     ICHESS_OK or ICHESS_INTERNAL_ERROR.
+static int evaluate(const Board& board, int& score)
+{
+  int status = ICHESS_OK;
+  score      = 0;
+  try
+  {
+    score = board.evaluate();
+  }
+  catch (...)
+  {
+    status = ICHESS_INTERNAL_ERROR;
+  }
+  return status;
+}
+
+/// @brief   Evaluate many FEN positions statically in one call.
+/// @details Reuses a single board for all positions, so only the pieces are allocated per position.
+int ichess_evaluate_fens(const char* const* fens, size_t count, int* scores, int* statuses)
+{
+  if ((!fens || !scores) && count > 0)
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  Board board;
+  int   result = ICHESS_OK;
+  for (size_t i = 0; i < count; i++)
+  {
+    int status = fens[i] ? load_fen(board, fens[i]) : ICHESS_INVALID_ARGUMENT;
+    scores[i]  = 0;
+    if (status == ICHESS_OK)
+    {
+      status = evaluate(board, scores[i]);
+    }
+    if (statuses)
+    {
+      statuses[i] = status;
+    }
+    if (result == ICHESS_OK)
+    {
+      result = status;
+    }
+  }
+  return result;
+}
+
+/// @brief   List the pseudo-legal moves of the side to move for many FEN positions in one call.
+/// @details Keeps counting past capacity so offsets always describe the full result.
+///          A too small buffer takes priority over failed positions, so the caller always
+///          learns that it has to retry.
+int ichess_pseudo_legal_moves_fens(const char* const* fens,
+                                   size_t             count,
+                                   ichess_move*       moves,
+                                   size_t             capacity,
+                                   size_t*            offsets)
+{
+  if (!offsets || (!fens && count > 0) || (!moves && capacity > 0))
+  {
+    return ICHESS_INVALID_ARGUMENT;
+  }
+  Board             board;
+  std::vector<Move> found;
+  size_t            total  = 0;
+  int               result = ICHESS_OK;
+  for (size_t i = 0; i < count; i++)
+  {
+    int status = fens[i] ? load_fen(board, fens[i]) : ICHESS_INVALID_ARGUMENT;
+    offsets[i] = total;
+    found.clear();
+    if (status == ICHESS_OK)
+    {
+      try
+      {
+        board.availableMoves(found);
+      }
+      catch (...)
+      {
+        std::fill(offsets + i + 1, offsets + count + 1, total);
+        return ICHESS_INTERNAL_ERROR;
+      }
+    }
+    else if (result == ICHESS_OK)
+    {
+      result = status;
+    }
+    for (const Move& move : found)
+    {
+      if (total < capacity)
+      {
+        moves[total] = to_c_move(move);
+      }
+      total++;
+    }
+  }
+  offsets[count] = total;
+  if (total > capacity)
+  {
+    result = ICHESS_BUFFER_TOO_SMALL;
+  }
+  return result;
+}
@@ -0,0 +1,73 @@
+/// @file      pawn_hash.cpp
+/// @brief     Implementation of the pawn structure hash table.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @details   Provides lookup, storage and statistics for cached pawn structure scores.
+
+#include "pawn_hash.hpp"
+
+/// @brief   Construct a PawnHashTable.
+/// @details Rounds the requested size down to a power of two so slots can be selected with a mask.
+PawnHashTable::PawnHashTable(std::size_t size)
+{
+  std::size_t slots = 1;
+  while (slots * 2 <= size)
+  {
+    slots *= 2;
+  }
+  entries.resize(slots);
+  mask = slots - 1;
+}
+
+/// @brief   Look up the pawn structure score of a pawn key.
+/// @details Compares the full key, so two keys sharing a slot never return each other's score.
+bool PawnHashTable::probe(const ZobristKey key, Score& score)
+{
+  const Entry& entry = entries[key & mask];
+  bool         found = entry.valid && entry.key == key;
+  probes++;
+  if (found)
+  {
+    hits++;
+    score = entry.score;
+  }
+  return found;
+}
+
+/// @brief Store the pawn structure score of a pawn key.
+void PawnHashTable::store(const ZobristKey key, const Score& score) { entries[key & mask] = {key, score, true}; }
+
+/// @brief Remove all entries and reset the statistics.
+void PawnHashTable::clear()
+{
+  for (Entry& entry : entries)
+  {
+    entry = {};
+  }
+  probes = 0;
+  hits   = 0;
+}
+
+/// @brief  Get the number of probes.
+/// @return Probe count.
+std::uint64_t PawnHashTable::getProbes() const { return probes; }
+
+/// @brief  Get the number of hits.
+/// @return Hit count.
+std::uint64_t PawnHashTable::getHits() const { return hits; }
+
+/// @brief  Get the fraction of probes that hit.
+/// @return Hit rate in [0, 1], or 0 when nothing was probed.
+double PawnHashTable::getHitRate() const
+{
+  return (probes == 0) ? 0.0 : static_cast<double>(hits) / static_cast<double>(probes);
+}
+
+/// @brief   Get the pawn hash table of the calling thread.
+/// @details The table is thread_local, so concurrent evaluations never share a table.
+PawnHashTable& PawnHashTable::local()
+{
+  thread_local PawnHashTable table;
+  return table;
+}
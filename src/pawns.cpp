@@ -34,29 +34,42 @@ static const int get_direction(const Piece::Color my_color)
   return direction;
 }
 
-/// @brief  Check if a pawn can capture at the target position.
-/// @param  other_p  Vector of positions of all other pieces on the board.
-/// @param  other_c  Vector of colors corresponding to each piece in other_p.
-/// @param  target_p The target position to check for capture.
-/// @param  my_color The color of the current pawn.
-/// @return True if the target position contains an opponent piece that can be captured.
-static const bool try_to_capture(const Piece::PositionList& other_p,
-                                 const Piece::ColorList&    other_c,
-                                 const Position&            target_p,
-                                 const Piece::Color         my_color)
+/// @brief      Check if a pawn can capture on its two diagonal target positions.
+/// @param[in]  other_p       Vector of positions of all other pieces on the board.
+/// @param[in]  other_c       Vector of colors corresponding to each piece in other_p.
+/// @param[in]  target_left   The left diagonal target position.
+/// @param[in]  target_right  The right diagonal target position.
+/// @param[in]  my_color      The color of the current pawn.
+/// @param[out] capture_left  True if target_left contains an opponent piece that can be captured.
+/// @param[out] capture_right True if target_right contains an opponent piece that can be captured.
+/// @details    Resolves both targets with a single scan of the other pieces instead of one search per target.
+///             The first piece found on a target position decides whether it can be captured.
+static void try_to_capture(const Piece::PositionList& other_p,
+                           const Piece::ColorList&    other_c,
+                           const Position&            target_left,
+                           const Position&            target_right,
+                           const Piece::Color         my_color,
+                           bool&                      capture_left,
+                           bool&                      capture_right)
 {
-  Piece::PositionList::const_iterator found_piece_itera  = std::find(other_p.begin(), other_p.end(), target_p);
-  bool                                valid_capture_flag = false;
-  if (found_piece_itera != other_p.end())
+  bool found_left  = false;
+  bool found_right = false;
+  capture_left     = false;
+  capture_right    = false;
+  for (size_t i = 0; i < other_p.size() && !(found_left && found_right); i++)
   {
-    size_t found_piece_index = 0;
-    found_piece_index        = std::distance(other_p.begin(), found_piece_itera);
-    if (other_c[found_piece_index] != my_color && other_c[found_piece_index] != Piece::Color::NONE)
+    const bool is_opponent = (other_c[i] != my_color && other_c[i] != Piece::Color::NONE);
+    if (!found_left && other_p[i] == target_left)
     {
-      valid_capture_flag = true;
+      found_left   = true;
+      capture_left = is_opponent;
+    }
+    else if (!found_right && other_p[i] == target_right)
+    {
+      found_right   = true;
+      capture_right = is_opponent;
     }
   }
-  return valid_capture_flag;
 }
 
 /// @brief   Check if en passant capture is possible at the target position.
@@ -81,71 +94,148 @@ static const bool try_to_capture_passant(const Properties& props, const Position
   return valid_capture_flag;
 }
 
-/// @brief      Calculate valid moves for this pawn.
-/// @param[out] p       Vector to be filled with valid move positions.
-/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
-/// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
-/// @param[in]  props   Properties of the board for move validation, used for en passant.
-/// @throws     std::runtime_error if the piece has an invalid color.
-/// @note       Implementation distinguishes between white and black pawns for directional movement.
-/// @details    Calculates all valid pawn moves including:
-///             - Forward moves (1 square, or 2 squares from starting position)
-///             - Diagonal captures of opponent pieces
-///             - En passant captures when opponent pawn moves two squares forward
-///             This overload provides piece positions and colors separately for move calculation.
-void Pawn::available_moves(Piece::PositionList&       p,
-                           const Piece::PositionList& other_p,
-                           const Piece::ColorList&    other_c,
-                           const Properties&          props) const
+/// @brief      Append the forward (non-capture) moves of a pawn.
+/// @param[out] p        Vector the quiet move positions are appended to.
+/// @param[in]  pos      The current position of the pawn.
+/// @param[in]  my_color The color of the pawn.
+/// @param[in]  other_p  Vector of positions of all other pieces on the board.
+/// @details    One square forward if empty, and two squares forward from the starting rank
+///             if both squares are empty.
+static void append_forward_moves(Piece::PositionList&       p,
+                                 const Position&            pos,
+                                 const Piece::Color         my_color,
+                                 const Piece::PositionList& other_p)
 {
-  int      direction      = 0;
-  Position move_candidate = position;
-
-  p.clear();
-  direction = get_direction(color);
+  int      direction      = get_direction(my_color);
+  Position move_candidate = pos;
 
   // Try to move one square forward if you are still in the board and the place is empty.
-  move_candidate = {position.file, static_cast<char>(position.rank + direction)};
+  move_candidate = {pos.file, static_cast<char>(pos.rank + direction)};
   if (is_in_grid_range(move_candidate) && other_p.end() == std::find(other_p.begin(), other_p.end(), move_candidate))
   {
     p.push_back(move_candidate);
 
     // Try to move two squares forward if you are still in the starting position and the place is empty.
-    move_candidate = {position.file, static_cast<char>(position.rank + 2 * direction)};
-    if (((position.rank == '2' && color == Piece::Color::WHITE)
-         || (position.rank == '7' && color == Piece::Color::BLACK))
+    move_candidate = {pos.file, static_cast<char>(pos.rank + 2 * direction)};
+    if (((pos.rank == '2' && my_color == Piece::Color::WHITE) || (pos.rank == '7' && my_color == Piece::Color::BLACK))
         && is_in_grid_range(move_candidate)
         && other_p.end() == std::find(other_p.begin(), other_p.end(), move_candidate))
     {
       p.push_back(move_candidate);
     }
   }
+}
+
+/// @brief      Append the capture moves of a pawn.
+/// @param[out] p        Vector the capture positions are appended to.
+/// @param[in]  pos      The current position of the pawn.
+/// @param[in]  my_color The color of the pawn.
+/// @param[in]  other_p  Vector of positions of all other pieces on the board.
+/// @param[in]  other_c  Vector of colors corresponding to each piece in other_p.
+/// @param[in]  props    Properties of the board, used for en passant.
+/// @details    Diagonal captures of opponent pieces first, then en passant captures.
+///             Both diagonals are resolved in one scan of the other pieces, and the en passant
+///             branches are skipped unless the last move ended on this pawn's rank.
+static void append_capture_moves(Piece::PositionList&       p,
+                                 const Position&            pos,
+                                 const Piece::Color         my_color,
+                                 const Piece::PositionList& other_p,
+                                 const Piece::ColorList&    other_c,
+                                 const Properties&          props)
+{
+  int      direction     = get_direction(my_color);
+  Position target_left   = {static_cast<char>(pos.file - 1), static_cast<char>(pos.rank + direction)};
+  Position target_right  = {static_cast<char>(pos.file + 1), static_cast<char>(pos.rank + direction)};
+  bool     left_in_grid  = is_in_grid_range(target_left);
+  bool     right_in_grid = is_in_grid_range(target_right);
+  bool     capture_left  = false;
+  bool     capture_right = false;
 
-  // Capture diagonally left
-  move_candidate = {static_cast<char>(position.file - 1), static_cast<char>(position.rank + direction)};
-  if (is_in_grid_range(move_candidate) && try_to_capture(other_p, other_c, move_candidate, color))
+  if (!left_in_grid && !right_in_grid)
   {
-    p.push_back(move_candidate);
+    return;
   }
 
-  // Capture diagonally right
-  move_candidate = {static_cast<char>(position.file + 1), static_cast<char>(position.rank + direction)};
-  if (is_in_grid_range(move_candidate) && try_to_capture(other_p, other_c, move_candidate, color))
+  // Capture diagonally left and right
+  try_to_capture(other_p, other_c, target_left, target_right, my_color, capture_left, capture_right);
+  if (left_in_grid && capture_left)
   {
-    p.push_back(move_candidate);
+    p.push_back(target_left);
+  }
+  if (right_in_grid && capture_right)
+  {
+    p.push_back(target_right);
+  }
+
+  // En passant is only possible right after an opponent pawn stopped next to this pawn.
+  if (props.turns_since_pawn_move != 0 || props.last_move_end.rank != pos.rank)
+  {
+    return;
   }
 
   // En passant capture left
-  move_candidate = {static_cast<char>(position.file - 1), static_cast<char>(position.rank + direction)};
-  if (is_in_grid_range(move_candidate) && try_to_capture_passant(props, move_candidate, direction))
+  if (left_in_grid && try_to_capture_passant(props, target_left, direction))
   {
-    p.push_back(move_candidate);
+    p.push_back(target_left);
   }
 
   // En passant capture right
-  move_candidate = {static_cast<char>(position.file + 1), static_cast<char>(position.rank + direction)};
-  if (is_in_grid_range(move_candidate) && try_to_capture_passant(props, move_candidate, direction))
+  if (right_in_grid && try_to_capture_passant(props, target_right, direction))
   {
-    p.push_back(move_candidate);
+    p.push_back(target_right);
   }
 }
+
+/// @brief      Calculate valid moves for this pawn.
+/// @param[out] p       Vector to be filled with valid move positions.
+/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+/// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
+/// @param[in]  props   Properties of the board for move validation, used for en passant.
+/// @throws     std::runtime_error if the piece has an invalid color.
+/// @note       Implementation distinguishes between white and black pawns for directional movement.
+/// @details    Calculates all valid pawn moves including:
+///             - Forward moves (1 square, or 2 squares from starting position)
+///             - Diagonal captures of opponent pieces
+///             - En passant captures when opponent pawn moves two squares forward
+///             This overload provides piece positions and colors separately for move calculation.
+void Pawn::available_moves(Piece::PositionList&       p,
+                           const Piece::PositionList& other_p,
+                           const Piece::ColorList&    other_c,
+                           const Properties&          props) const
+{
+  p.clear();
+  append_forward_moves(p, position, color, other_p);
+  append_capture_moves(p, position, color, other_p, other_c, props);
+}
+
+/// @brief      Calculate capture-only moves for this pawn.
+/// @param[out] p       Vector to be filled with valid capture positions.
+/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+/// @param[in]  other_c Vector of colors corresponding to each piece in other_p for determining valid captures.
+/// @param[in]  props   Properties of the board for move validation, used for en passant.
+/// @throws     std::runtime_error if the piece has an invalid color.
+/// @details    Only the diagonal and en passant branches are evaluated; forward moves are skipped.
+void Pawn::available_captures(Piece::PositionList&       p,
+                              const Piece::PositionList& other_p,
+                              const Piece::ColorList&    other_c,
+                              const Properties&          props) const
+{
+  p.clear();
+  append_capture_moves(p, position, color, other_p, other_c, props);
+}
+
+/// @brief      Calculate quiet (forward) moves for this pawn.
+/// @param[out] p       Vector to be filled with valid quiet move positions.
+/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+/// @param[in]  other_c Vector of colors corresponding to each piece in other_p, unused for quiet moves.
+/// @param[in]  props   Properties of the board for move validation, unused for quiet moves.
+/// @throws     std::runtime_error if the piece has an invalid color.
+/// @details    Only the one and two squares forward branches are evaluated; captures are skipped.
+void Pawn::available_quiets(Piece::PositionList&       p,
+                            const Piece::PositionList& other_p,
+                            const Piece::ColorList&    other_c,
+                            const Properties&          props) const
+{
+  p.clear();
+  append_forward_moves(p, position, color, other_p);
+}
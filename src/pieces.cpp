@@ -7,6 +7,7 @@
 ///            and piece representation functionality.
 
 #include <cctype>
+#include <algorithm>
 
 #include "pieces.hpp"
 
@@ -26,6 +27,14 @@ const bool Piece::is_black() const { return color == Piece::Color::BLACK; }
 /// @return True if the piece color is WHITE.
 const bool Piece::is_white() const { return color == Piece::Color::WHITE; }
 
+/// @brief  Get the type of this piece.
+/// @return The piece type.
+const Piece::Type Piece::get_type() const { return type; }
+
+/// @brief  Get the color of this piece.
+/// @return The piece color.
+const Piece::Color Piece::get_color() const { return color; }
+
 /// @brief   Set the position of the piece on the board (file: 'a'-'h', rank: '1'-'8').
 /// @details Validates coordinates and sets them if valid (file: a-h, rank: 1-8).
 ///          Invalid coordinates are set to space character ' '.
@@ -75,17 +84,13 @@ const char Piece::get_representation() const
   return res;
 }
 
-/// @brief      Calculate valid moves for this piece using List parameter.
-/// @param[out] p     Vector to be filled with valid move positions.
-/// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
-/// @param[in]  props   Properties of the board for move validation.
-/// @details    This method extracts positions and colors from the List and calls the pure virtual overload.
-///             Provides a convenient interface for callers using the Piece::List container.
-void Piece::available_moves(PositionList& p, const List& other, const Properties& props) const
+/// @brief      Split a Piece::List into separate position and color vectors.
+/// @param[in]  other   Vector of unique pointers to all other pieces on the board.
+/// @param[out] other_p Vector to be filled with the positions of the pieces.
+/// @param[out] other_c Vector to be filled with the colors of the pieces.
+static void split_list(const Piece::List& other, Piece::PositionList& other_p, Piece::ColorList& other_c)
 {
-  PositionList other_p;
-  ColorList    other_c;
-  char         f, r;
+  char f, r;
   for (const std::unique_ptr<Piece>& piece : other)
   {
     piece->get_position(f, r);
@@ -104,5 +109,88 @@ void Piece::available_moves(PositionList& p, const List& other, const Properties
       other_c.push_back(Piece::Color::NONE);
     }
   }
+}
+
+/// @brief      Calculate valid moves for this piece using List parameter.
+/// @param[out] p     Vector to be filled with valid move positions.
+/// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
+/// @param[in]  props   Properties of the board for move validation.
+/// @details    This method extracts positions and colors from the List and calls the pure virtual overload.
+///             Provides a convenient interface for callers using the Piece::List container.
+void Piece::available_moves(PositionList& p, const List& other, const Properties& props) const
+{
+  PositionList other_p;
+  ColorList    other_c;
+  split_list(other, other_p, other_c);
   available_moves(p, other_p, other_c, props);
 }
+
+/// @brief      Calculate capture-only moves for this piece using List parameter.
+/// @param[out] p     Vector to be filled with valid capture positions.
+/// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
+/// @param[in]  props Properties of the board for move validation.
+void Piece::available_captures(PositionList& p, const List& other, const Properties& props) const
+{
+  PositionList other_p;
+  ColorList    other_c;
+  split_list(other, other_p, other_c);
+  available_captures(p, other_p, other_c, props);
+}
+
+/// @brief      Calculate quiet (non-capture) moves for this piece using List parameter.
+/// @param[out] p     Vector to be filled with valid quiet move positions.
+/// @param[in]  other Vector of unique pointers to all other pieces on the board for move validation.
+/// @param[in]  props Properties of the board for move validation.
+void Piece::available_quiets(PositionList& p, const List& other, const Properties& props) const
+{
+  PositionList other_p;
+  ColorList    other_c;
+  split_list(other, other_p, other_c);
+  available_quiets(p, other_p, other_c, props);
+}
+
+/// @brief      Calculate capture-only moves for this piece.
+/// @param[out] p       Vector to be filled with valid capture positions.
+/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+/// @param[in]  other_c Vector of colors corresponding to each piece in other_p.
+/// @param[in]  props   Properties of the board for move validation.
+/// @details    Generates all moves and keeps those whose target square is occupied.
+void Piece::available_captures(PositionList&       p,
+                               const PositionList& other_p,
+                               const ColorList&    other_c,
+                               const Properties&   props) const
+{
+  PositionList all_moves;
+  available_moves(all_moves, other_p, other_c, props);
+  p.clear();
+  for (const Position& m : all_moves)
+  {
+    if (other_p.end() != std::find(other_p.begin(), other_p.end(), m))
+    {
+      p.push_back(m);
+    }
+  }
+}
+
+/// @brief      Calculate quiet (non-capture) moves for this piece.
+/// @param[out] p       Vector to be filled with valid quiet move positions.
+/// @param[in]  other_p Vector of positions of all other pieces on the board for move validation.
+/// @param[in]  other_c Vector of colors corresponding to each piece in other_p.
+/// @param[in]  props   Properties of the board for move validation.
+/// @details    Generates all moves and keeps those whose target square is empty.
+void Piece::available_quiets(PositionList&       p,
+                             const PositionList& other_p,
+                             const ColorList&    other_c,
+                             const Properties&   props) const
+{
+  PositionList all_moves;
+  available_moves(all_moves, other_p, other_c, props);
+  p.clear();
+  for (const Position& m : all_moves)
+  {
+    if (other_p.end() == std::find(other_p.begin(), other_p.end(), m))
+    {
+      p.push_back(m);
+    }
+  }
+}
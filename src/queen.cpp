@@ -14,4 +14,5 @@ void Queen::available_moves(Piece::PositionList&       p,
                             const Piece::ColorList&    other_c,
                             const Properties&          props) const
 {
+  p.clear();
 }
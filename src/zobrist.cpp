@@ -0,0 +1,138 @@
+/// @file      zobrist.cpp
+/// @brief     Implementation of the Zobrist hashing keys.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @details   Generates one key per piece type, color and square with a splitmix64
+///            sequence evaluated at compile time,
+///            plus one key per castling right, one for black to move and one per en passant file.
+
+#include <array>
+
+#include "zobrist.hpp"
+
+inline constexpr int PIECE_KEY_COUNT    = 2 * 6 * 64; ///< Two colors, six piece types, 64 squares
+inline constexpr int CASTLING_KEY_COUNT = 4;          ///< Two castling sides for each color
+
+/// @brief Index of the key XORed in when black is to move, right after the castling keys.
+inline constexpr int SIDE_KEY_INDEX = PIECE_KEY_COUNT + CASTLING_KEY_COUNT;
+
+/// @brief Index of the key of the en passant file 'a', right after the side to move key.
+inline constexpr int PASSANT_KEY_INDEX = SIDE_KEY_INDEX + 1;
+
+/// @brief Total number of keys: piece keys, castling keys, the side to move key, then the en passant keys.
+inline constexpr int KEY_COUNT = PASSANT_KEY_INDEX + 8;
+
+/// @brief  Advance a splitmix64 generator and return its next value.
+/// @param  state Generator state, updated in place.
+/// @return The next pseudo-random 64-bit value.
+static constexpr ZobristKey splitmix64(ZobristKey& state)
+{
+  ZobristKey z = (state += 0x9E3779B97F4A7C15ULL);
+  z            = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z            = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+/// @brief  Build the table of keys.
+/// @return One key per color, piece type and square, one key per castling right, the side key
+///         and one key per en passant file.
+static constexpr std::array<ZobristKey, KEY_COUNT> make_keys()
+{
+  std::array<ZobristKey, KEY_COUNT> keys  = {};
+  ZobristKey                        state = 0x1C4E55C0DE5EEDULL;
+  for (int i = 0; i < KEY_COUNT; i++)
+  {
+    keys[i] = splitmix64(state);
+  }
+  return keys;
+}
+
+static constexpr std::array<ZobristKey, KEY_COUNT> keys = make_keys();
+
+/// @brief  Map a piece type to its row in the key table.
+/// @param  type The type of the piece.
+/// @return Index from 0 (pawn) to 5 (king), or -1 for Piece::Type::NONE.
+static int type_index(const Piece::Type type)
+{
+  int index = -1;
+  switch (type)
+  {
+  case Piece::Type::PAWN:
+    index = 0;
+    break;
+  case Piece::Type::KNIGHT:
+    index = 1;
+    break;
+  case Piece::Type::BISHOP:
+    index = 2;
+    break;
+  case Piece::Type::ROOK:
+    index = 3;
+    break;
+  case Piece::Type::QUEEN:
+    index = 4;
+    break;
+  case Piece::Type::KING:
+    index = 5;
+    break;
+  default:
+    break;
+  }
+  return index;
+}
+
+/// @brief  Get the Zobrist key of a piece on a square.
+/// @param  type  The type of the piece.
+/// @param  color The color of the piece.
+/// @param  pos   The position of the piece on the board.
+/// @return The key for this placement, or 0 if the piece or position is not valid.
+ZobristKey zobrist_piece_key(const Piece::Type type, const Piece::Color color, const Position& pos)
+{
+  int t = type_index(type);
+  if (t < 0 || color == Piece::Color::NONE || !is_in_grid_range(pos))
+  {
+    return 0;
+  }
+  int c      = (color == Piece::Color::WHITE) ? 0 : 1;
+  int square = (pos.rank - '1') * 8 + (pos.file - 'a');
+  return keys[(c * 6 + t) * 64 + square];
+}
+
+/// @brief  Get the Zobrist key of the castling rights.
+/// @param  props Board properties holding the king and rook moved flags.
+/// @return XOR of the keys of all castling rights still available.
+ZobristKey zobrist_castling_key(const Properties& props)
+{
+  ZobristKey key = 0;
+  if (!props.white_king_has_moved && !props.white_rook_king_side_has_moved)
+  {
+    key ^= keys[PIECE_KEY_COUNT + 0];
+  }
+  if (!props.white_king_has_moved && !props.white_rook_queen_side_has_moved)
+  {
+    key ^= keys[PIECE_KEY_COUNT + 1];
+  }
+  if (!props.black_king_has_moved && !props.black_rook_king_side_has_moved)
+  {
+    key ^= keys[PIECE_KEY_COUNT + 2];
+  }
+  if (!props.black_king_has_moved && !props.black_rook_queen_side_has_moved)
+  {
+    key ^= keys[PIECE_KEY_COUNT + 3];
+  }
+  return key;
+}
+
+/// @brief  Get the Zobrist key of the side to move.
+/// @param  props Board properties holding the side to move.
+/// @return The side key when black is to move, 0 otherwise.
+ZobristKey zobrist_side_key(const Properties& props) { return props.white_to_move ? 0 : keys[SIDE_KEY_INDEX]; }
+
+/// @brief  Get the Zobrist key of an en passant file.
+/// @param  file File of the pawn that can be captured en passant.
+/// @return The key of that file, or 0 if the file is not on the board.
+ZobristKey zobrist_passant_key(const char file)
+{
+  return ('a' <= file && file <= 'h') ? keys[PASSANT_KEY_INDEX + (file - 'a')] : 0;
+}
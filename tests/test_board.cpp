@@ -9,6 +9,9 @@
 ///             - Smart pointer memory management
 ///             - Board display operations
 ///             - Standard chess setup validation
+///             - Repetition, fifty-move and insufficient material draws
+///             - Single move legality checks
+///             - FEN loading and move generation for the side to move
 /// @note       Uses std::unique_ptr for automatic memory management
 ///             following modern C++ RAII principles.
 
@@ -17,6 +20,11 @@
 #include <memory>
 
 #include "board.hpp"
+#include "knight.hpp"
+#include "bishop.hpp"
+#include "rook.hpp"
+#include "pawns.hpp"
+#include "king.hpp"
 
 /// @class   BoardTest
 /// @brief   Test fixture class for Board unit tests.
@@ -33,6 +41,37 @@ class BoardTest : public ::testing::Test
     /// @details Automatically releases Board instance using smart pointer reset.
     void TearDown() override { p_test_board.reset(); }
 
+    /// @brief   Place kings on e1/e8 and one knight per side on the board under test.
+    /// @param   white_knight Position of the white knight.
+    /// @param   black_knight Position of the black knight.
+    /// @param   clock        Halfmove clock to store in the board properties.
+    /// @details Stands in for applying a knight move, which the Board cannot do yet.
+    void placeKnights(const Position& white_knight, const Position& black_knight, const int clock)
+    {
+      Properties props     = default_properties;
+      props.halfmove_clock = clock;
+      p_test_board->cleanPieces();
+      p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+      p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+      p_test_board->addPiece(std::make_unique<Knight>(white_knight.file, white_knight.rank, Piece::Color::WHITE));
+      p_test_board->addPiece(std::make_unique<Knight>(black_knight.file, black_knight.rank, Piece::Color::BLACK));
+      p_test_board->setProperties(props);
+    }
+
+    /// @brief   Play Nf3 Nf6 Ng1 Ng8 on the board under test, recording history before each move.
+    /// @param   clock Halfmove clock before the first move.
+    void shuffleKnights(const int clock)
+    {
+      p_test_board->pushHistory();
+      placeKnights({'f', '3'}, {'g', '8'}, clock + 1);
+      p_test_board->pushHistory();
+      placeKnights({'f', '3'}, {'f', '6'}, clock + 2);
+      p_test_board->pushHistory();
+      placeKnights({'g', '1'}, {'f', '6'}, clock + 3);
+      p_test_board->pushHistory();
+      placeKnights({'g', '1'}, {'g', '8'}, clock + 4);
+    }
+
     /// @brief   Smart pointer to the Board instance under test.
     /// @details Uses std::unique_ptr for automatic memory management.
     std::unique_ptr<Board> p_test_board;
@@ -71,3 +110,270 @@ TEST_F(BoardTest, DisplayStandardSetup)
   EXPECT_NO_THROW(p_test_board->initializeStandardSetup());
   EXPECT_NO_THROW(p_test_board->display());
 }
+
+/// @brief   Test that reinitializing a board does not keep old pieces.
+/// @details Verifies that two standard setups in a row give the same position
+///          as a single one, as reused boards are set up again for every game.
+TEST_F(BoardTest, StandardSetupReplacesPieces)
+{
+  Board once;
+  once.initializeStandardSetup();
+  p_test_board->initializeStandardSetup();
+  p_test_board->initializeStandardSetup();
+
+  EXPECT_EQ(once.getPositionKey(), p_test_board->getPositionKey());
+  EXPECT_EQ(once.evaluate(), p_test_board->evaluate());
+}
+
+/// @brief   Test that the standard setup also resets the board state.
+/// @details Loads a black-to-move FEN with a high halfmove clock and some history, then
+///          verifies that a standard setup starts a fresh game with white to move.
+TEST_F(BoardTest, StandardSetupResetsState)
+{
+  Board fresh;
+  fresh.initializeStandardSetup();
+
+  p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 b - - 99 1");
+  p_test_board->pushHistory();
+  p_test_board->initializeStandardSetup();
+
+  EXPECT_TRUE(p_test_board->getProperties().white_to_move);
+  EXPECT_EQ(p_test_board->getProperties().halfmove_clock, 0);
+  EXPECT_EQ(p_test_board->getPositionKey(), fresh.getPositionKey());
+  EXPECT_TRUE(p_test_board->isLegal({{'e', '2'}, {'e', '4'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '7'}, {'e', '5'}}));
+}
+
+/// @brief   Test repetition detection from the position history.
+/// @details Shuffles knights back and forth and verifies twofold and threefold
+///          repetitions, and that popping history entries undoes them.
+TEST_F(BoardTest, RepetitionDetection)
+{
+  placeKnights({'g', '1'}, {'g', '8'}, 0);
+  EXPECT_EQ(p_test_board->countRepetitions(), 0);
+
+  shuffleKnights(0);
+  EXPECT_EQ(p_test_board->countRepetitions(), 1);
+  EXPECT_TRUE(p_test_board->isRepetition());
+  EXPECT_FALSE(p_test_board->isThreefoldRepetition());
+
+  shuffleKnights(4);
+  EXPECT_EQ(p_test_board->countRepetitions(), 2);
+  EXPECT_TRUE(p_test_board->isThreefoldRepetition());
+  EXPECT_TRUE(p_test_board->isDraw());
+
+  // Taking back the last four plies leaves a single earlier occurrence
+  for (int i = 0; i < 4; i++)
+  {
+    p_test_board->popHistory();
+  }
+  EXPECT_EQ(p_test_board->countRepetitions(), 1);
+
+  p_test_board->clearHistory();
+  EXPECT_EQ(p_test_board->countRepetitions(), 0);
+}
+
+/// @brief   Test that the repetition scan stops at the last irreversible move.
+/// @details A halfmove clock smaller than the distance to an earlier occurrence
+///          hides it, as no position before a pawn move or capture can repeat.
+TEST_F(BoardTest, RepetitionBoundedByHalfmoveClock)
+{
+  placeKnights({'g', '1'}, {'g', '8'}, 0);
+  shuffleKnights(0);
+
+  Properties props     = p_test_board->getProperties();
+  props.halfmove_clock = 3;
+  p_test_board->setProperties(props);
+  EXPECT_EQ(p_test_board->countRepetitions(), 0);
+
+  // Castling rights are part of the position key
+  props.halfmove_clock       = 4;
+  props.white_king_has_moved = true;
+  p_test_board->setProperties(props);
+  EXPECT_EQ(p_test_board->countRepetitions(), 0);
+}
+
+/// @brief   Test the fifty-move rule.
+/// @details Verifies that 100 plies without a pawn move or capture is a draw.
+TEST_F(BoardTest, FiftyMoveDraw)
+{
+  Properties props = default_properties;
+  p_test_board->initializeStandardSetup();
+
+  props.halfmove_clock = 99;
+  p_test_board->setProperties(props);
+  EXPECT_FALSE(p_test_board->isFiftyMoveDraw());
+  EXPECT_FALSE(p_test_board->isDraw());
+
+  props.halfmove_clock = 100;
+  p_test_board->setProperties(props);
+  EXPECT_TRUE(p_test_board->isFiftyMoveDraw());
+  EXPECT_TRUE(p_test_board->isDraw());
+}
+
+/// @brief   Test that captures restart the halfmove clock without enabling en passant.
+/// @details A rook capture f7xf5 resets the halfmove clock, but turns_since_pawn_move keeps
+///          counting, so the white pawn on e5 must not capture en passant on f6.
+TEST_F(BoardTest, CaptureDoesNotEnablePassant)
+{
+  Properties props = default_properties;
+  p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  p_test_board->addPiece(std::make_unique<Pawn>('e', '5', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<Rook>('f', '5', Piece::Color::BLACK));
+
+  props.last_move_start       = {'f', '7'};
+  props.last_move_end         = {'f', '5'};
+  props.turns_since_pawn_move = 3;
+  props.halfmove_clock        = 0;
+  p_test_board->setProperties(props);
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '5'}, {'f', '6'}}));
+  EXPECT_FALSE(p_test_board->isFiftyMoveDraw());
+}
+
+/// @brief   Test that en passant rights are part of the position key.
+/// @details The same placement hashes differently when a capture en passant is available,
+///          and the same when the double step cannot be captured.
+TEST_F(BoardTest, PassantInPositionKey)
+{
+  Board      quiet_board;
+  ZobristKey quiet_key = 0;
+  quiet_board.loadFen("4k3/8/8/3pP3/8/8/8/4K3 w - - 0 1");
+  quiet_key = quiet_board.getPositionKey();
+
+  // Black just played d7-d5 next to the white pawn on e5
+  p_test_board->loadFen("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1");
+  EXPECT_TRUE(p_test_board->isLegal({{'e', '5'}, {'d', '6'}}));
+  EXPECT_NE(p_test_board->getPositionKey(), quiet_key);
+
+  // Without a white pawn next to d5 the double step gives no rights
+  quiet_board.loadFen("4k3/8/8/3p4/4P3/8/8/4K3 w - - 0 1");
+  p_test_board->loadFen("4k3/8/8/3p4/4P3/8/8/4K3 w - d6 0 1");
+  EXPECT_EQ(p_test_board->getPositionKey(), quiet_board.getPositionKey());
+}
+
+/// @brief   Test insufficient material detection.
+/// @details Verifies bare kings, single minor pieces and same-colored bishops
+///          are draws, while pawns, rooks and opposite-colored bishops are not.
+TEST_F(BoardTest, InsufficientMaterial)
+{
+  p_test_board->initializeStandardSetup();
+  EXPECT_FALSE(p_test_board->hasInsufficientMaterial());
+
+  p_test_board->cleanPieces();
+  p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  EXPECT_TRUE(p_test_board->hasInsufficientMaterial());
+
+  // A single knight cannot mate
+  p_test_board->addPiece(std::make_unique<Knight>('b', '1', Piece::Color::WHITE));
+  EXPECT_TRUE(p_test_board->hasInsufficientMaterial());
+
+  // Bishops on c1 and f8 stand on dark squares, mate stays impossible
+  p_test_board->cleanPieces();
+  p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  p_test_board->addPiece(std::make_unique<Bishop>('c', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<Bishop>('f', '8', Piece::Color::BLACK));
+  EXPECT_TRUE(p_test_board->hasInsufficientMaterial());
+
+  // A light-squared bishop on f1 makes mate possible
+  p_test_board->addPiece(std::make_unique<Bishop>('f', '1', Piece::Color::WHITE));
+  EXPECT_FALSE(p_test_board->hasInsufficientMaterial());
+
+  // Pawns and rooks make mate possible
+  p_test_board->cleanPieces();
+  p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  p_test_board->addPiece(std::make_unique<Pawn>('a', '2', Piece::Color::WHITE));
+  EXPECT_FALSE(p_test_board->hasInsufficientMaterial());
+
+  p_test_board->cleanPieces();
+  p_test_board->addPiece(std::make_unique<King>('e', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  p_test_board->addPiece(std::make_unique<Rook>('a', '1', Piece::Color::WHITE));
+  EXPECT_FALSE(p_test_board->hasInsufficientMaterial());
+}
+
+/// @brief   Test legality checks of single moves.
+/// @details Verifies that pawn moves allowed by the pawn rules are accepted and
+///          that moves from empty squares, off the board or onto own pieces are rejected.
+TEST_F(BoardTest, SingleMoveLegality)
+{
+  p_test_board->initializeStandardSetup();
+
+  EXPECT_TRUE(p_test_board->isLegal({{'e', '2'}, {'e', '4'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'d', '7'}, {'d', '6'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '2'}, {'e', '5'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '2'}, {'d', '3'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '4'}, {'e', '5'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '1'}, {'e', '2'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '2'}, {'e', '9'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '2'}, {'e', '2'}}));
+
+  // Pawn captures need an opponent piece on the diagonal
+  p_test_board->addPiece(std::make_unique<Knight>('d', '3', Piece::Color::BLACK));
+  EXPECT_TRUE(p_test_board->isLegal({{'e', '2'}, {'d', '3'}}));
+  EXPECT_TRUE(p_test_board->isLegal({{'c', '2'}, {'d', '3'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'d', '2'}, {'d', '3'}}));
+
+  // Only the side to move may move
+  Properties props    = p_test_board->getProperties();
+  props.white_to_move = false;
+  p_test_board->setProperties(props);
+  EXPECT_TRUE(p_test_board->isLegal({{'d', '7'}, {'d', '6'}}));
+  EXPECT_FALSE(p_test_board->isLegal({{'e', '2'}, {'e', '4'}}));
+}
+
+/// @brief   Test loading positions from FEN strings.
+/// @details Verifies that the standard FEN matches the standard setup, that side to move,
+///          castling rights and en passant are read, and that malformed FEN is rejected,
+///          including bad castling rights, move counters and en passant ranks or trailing text.
+TEST_F(BoardTest, LoadFen)
+{
+  Board standard_board;
+  standard_board.initializeStandardSetup();
+  p_test_board->loadFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+  EXPECT_EQ(p_test_board->getPositionKey(), standard_board.getPositionKey());
+  EXPECT_EQ(p_test_board->evaluate(), standard_board.evaluate());
+
+  // White just played d2-d4 next to the black pawn on e4, which can capture en passant on d3
+  p_test_board->loadFen("4k3/8/8/8/3Pp3/8/8/4K3 b - d3 0 1");
+  EXPECT_FALSE(p_test_board->getProperties().white_to_move);
+  EXPECT_TRUE(p_test_board->getProperties().white_rook_king_side_has_moved);
+  EXPECT_TRUE(p_test_board->isLegal({{'e', '4'}, {'d', '3'}}));
+  EXPECT_NE(p_test_board->getPositionKey(), standard_board.getPositionKey());
+
+  // Malformed FEN throws and leaves the board unchanged
+  ZobristKey key = p_test_board->getPositionKey();
+  EXPECT_THROW(p_test_board->loadFen(""), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("8/8/8/8/8/8/8 w - - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("9/8/8/8/8/8/8/8 w - - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4x3/8/8/8/8/8/8/8 w - - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("8/8/8/8/8/8/8/8 x - - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w zzz - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w KK - 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w - - abc 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w - - -7 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w - - 0 x"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/4P3/8/8/4K3 w - e3 0 1"), std::invalid_argument);
+  EXPECT_THROW(p_test_board->loadFen("4k3/8/8/8/8/8/8/4K3 w - - 0 1 junk"), std::invalid_argument);
+  EXPECT_EQ(p_test_board->getPositionKey(), key);
+}
+
+/// @brief   Test move generation for the side to move.
+/// @details Verifies that only pieces of the side to move contribute moves.
+TEST_F(BoardTest, AvailableMovesOfSideToMove)
+{
+  std::vector<Move> moves;
+  p_test_board->initializeStandardSetup();
+  p_test_board->availableMoves(moves);
+
+  // 16 pawn moves for white; other pieces have no movement rules yet
+  EXPECT_EQ(moves.size(), 16u);
+  for (const Move& move : moves)
+  {
+    EXPECT_EQ(move.start.rank, '2');
+    EXPECT_TRUE(p_test_board->isLegal(move));
+  }
+}
@@ -0,0 +1,85 @@
+/// @file      test_board_pool.cpp
+/// @brief     Unit tests for the BoardPool class using Google Test framework.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Test suite for BoardPool class functionality including:
+///             - Preallocation and exhaustion of the pool
+///             - Recycling of released boards
+///             - Reset of pieces, properties and history on release
+///             - Rejection of boards released twice or into the wrong pool
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "board_pool.hpp"
+
+/// @brief   Test acquiring boards until the pool is exhausted.
+/// @details Verifies that the pool hands out distinct boards and returns
+///          nullptr once all of them are in use.
+TEST(BoardPoolTest, AcquireUntilExhausted)
+{
+  BoardPool pool(2);
+  EXPECT_EQ(pool.size(), 2u);
+  EXPECT_EQ(pool.available(), 2u);
+
+  Board* first  = pool.acquire();
+  Board* second = pool.acquire();
+  EXPECT_NE(first, nullptr);
+  EXPECT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(pool.available(), 0u);
+  EXPECT_EQ(pool.acquire(), nullptr);
+}
+
+/// @brief   Test that released boards are recycled and reset.
+/// @details Verifies that a released board is handed out again with no pieces,
+///          default properties and an empty history.
+TEST(BoardPoolTest, ReleaseRecyclesAndResets)
+{
+  BoardPool pool(1);
+
+  Board*     board = pool.acquire();
+  Properties props = default_properties;
+  board->initializeStandardSetup();
+  props.turns_since_pawn_move = 7;
+  board->setProperties(props);
+  board->pushHistory();
+
+  pool.release(board);
+  EXPECT_EQ(pool.available(), 1u);
+
+  Board* recycled = pool.acquire();
+  EXPECT_EQ(recycled, board);
+  EXPECT_EQ(recycled->getPositionKey(), Board().getPositionKey());
+  EXPECT_EQ(recycled->getProperties().turns_since_pawn_move, 0);
+  EXPECT_EQ(recycled->countRepetitions(), 0);
+  EXPECT_EQ(recycled->evaluate(), 0);
+
+  // Releasing a null pointer is ignored
+  pool.release(nullptr);
+  EXPECT_EQ(pool.available(), 0u);
+}
+
+/// @brief   Test that boards cannot be released twice or into the wrong pool.
+/// @details Verifies that both cases throw and leave the free list unchanged, so no
+///          board is ever handed out to two games.
+TEST(BoardPoolTest, ReleaseRejectsUnknownBoards)
+{
+  BoardPool pool(2);
+  BoardPool other_pool(1);
+  Board     standalone;
+
+  Board* board = pool.acquire();
+  pool.release(board);
+  EXPECT_THROW(pool.release(board), std::invalid_argument);
+  EXPECT_EQ(pool.available(), 2u);
+
+  EXPECT_THROW(pool.release(other_pool.acquire()), std::invalid_argument);
+  EXPECT_THROW(pool.release(&standalone), std::invalid_argument);
+  EXPECT_EQ(pool.available(), 2u);
+
+  // Two acquisitions still hand out distinct boards
+  EXPECT_NE(pool.acquire(), pool.acquire());
+}
@@ -0,0 +1,192 @@
+/// @file      test_evaluation.cpp
+/// @brief     Unit tests for the material and piece-square-table evaluation.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Test suite for evaluation functionality including:
+///             - Piece values and game phase weights
+///             - Color symmetry of piece-square values
+///             - Tapering between midgame and endgame
+///             - Incremental evaluation sums kept by the Board
+///             - Pawn structure terms, pawn key and pawn hash table
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+
+#include "board.hpp"
+#include "evaluation.hpp"
+#include "pawn_hash.hpp"
+#include "pawns.hpp"
+#include "queen.hpp"
+#include "king.hpp"
+
+/// @class   EvaluationTest
+/// @brief   Test fixture class for evaluation unit tests.
+/// @details Provides an empty Board instance for each test.
+class EvaluationTest : public ::testing::Test
+{
+  protected:
+    /// @brief   Set up test environment before each test.
+    /// @details Creates a new Board instance using std::make_unique.
+    void SetUp() override { p_test_board = std::make_unique<Board>(); }
+
+    /// @brief   Clean up test environment after each test.
+    /// @details Automatically releases Board instance using smart pointer reset.
+    void TearDown() override { p_test_board.reset(); }
+
+    /// @brief   Smart pointer to the Board instance under test.
+    /// @details Uses std::unique_ptr for automatic memory management.
+    std::unique_ptr<Board> p_test_board;
+};
+
+/// @brief   Test piece values and phase weights.
+/// @details Verifies that piece values follow the usual ordering and that
+///          only minor and major pieces contribute to the game phase.
+TEST_F(EvaluationTest, PieceValues)
+{
+  EXPECT_EQ(piece_value(Piece::Type::NONE).mg, 0);
+  EXPECT_EQ(piece_value(Piece::Type::KING).mg, 0);
+  EXPECT_LT(piece_value(Piece::Type::PAWN).mg, piece_value(Piece::Type::KNIGHT).mg);
+  EXPECT_LT(piece_value(Piece::Type::KNIGHT).mg, piece_value(Piece::Type::ROOK).mg);
+  EXPECT_LT(piece_value(Piece::Type::ROOK).mg, piece_value(Piece::Type::QUEEN).mg);
+
+  EXPECT_EQ(piece_phase(Piece::Type::PAWN), 0);
+  EXPECT_EQ(2 * piece_phase(Piece::Type::KNIGHT) + 2 * piece_phase(Piece::Type::BISHOP)
+                + 2 * piece_phase(Piece::Type::ROOK) + piece_phase(Piece::Type::QUEEN),
+            MAX_GAME_PHASE / 2);
+}
+
+/// @brief   Test color symmetry of piece-square values.
+/// @details Verifies that a black piece on the rank-mirrored square of a white
+///          piece contributes the exact opposite score.
+TEST_F(EvaluationTest, ColorSymmetry)
+{
+  Score white = piece_square_value(Piece::Type::KNIGHT, Piece::Color::WHITE, {'c', '3'});
+  Score black = piece_square_value(Piece::Type::KNIGHT, Piece::Color::BLACK, {'c', '6'});
+
+  EXPECT_EQ(white.mg, -black.mg);
+  EXPECT_EQ(white.eg, -black.eg);
+
+  // Off-board pieces contribute nothing
+  Score off_board = piece_square_value(Piece::Type::QUEEN, Piece::Color::WHITE, {' ', ' '});
+  EXPECT_EQ(off_board.mg, 0);
+  EXPECT_EQ(off_board.eg, 0);
+}
+
+/// @brief   Test tapering between midgame and endgame terms.
+/// @details Verifies the blend at both ends of the phase range and that
+///          out-of-range phases are clamped.
+TEST_F(EvaluationTest, Taper)
+{
+  Score score = {100, 200};
+
+  EXPECT_EQ(taper(score, MAX_GAME_PHASE), 100);
+  EXPECT_EQ(taper(score, 0), 200);
+  EXPECT_EQ(taper(score, MAX_GAME_PHASE / 2), 150);
+  EXPECT_EQ(taper(score, MAX_GAME_PHASE + 10), 100);
+  EXPECT_EQ(taper(score, -10), 200);
+}
+
+/// @brief   Test evaluation of empty and standard positions.
+/// @details Verifies that both the empty board and the symmetric starting
+///          position evaluate to zero, and that cleaning the board resets the sums.
+TEST_F(EvaluationTest, StandardSetupIsBalanced)
+{
+  EXPECT_EQ(p_test_board->evaluate(), 0);
+
+  p_test_board->initializeStandardSetup();
+  EXPECT_EQ(p_test_board->evaluate(), 0);
+
+  p_test_board->addPiece(std::make_unique<Queen>('d', '4', Piece::Color::WHITE));
+  EXPECT_GT(p_test_board->evaluate(), 0);
+
+  p_test_board->cleanPieces();
+  EXPECT_EQ(p_test_board->evaluate(), 0);
+}
+
+/// @brief   Test that incremental sums match a full recomputation.
+/// @details Adds pieces one by one and compares evaluate() before and after
+///          rebuilding the running sums from scratch.
+TEST_F(EvaluationTest, IncrementalMatchesRefresh)
+{
+  p_test_board->addPiece(std::make_unique<King>('g', '1', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<King>('e', '8', Piece::Color::BLACK));
+  p_test_board->addPiece(std::make_unique<Pawn>('e', '5', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<Queen>('a', '5', Piece::Color::BLACK));
+
+  int incremental = p_test_board->evaluate();
+  p_test_board->refreshEvaluation();
+
+  EXPECT_EQ(incremental, p_test_board->evaluate());
+  EXPECT_LT(incremental, 0);
+}
+
+/// @brief   Test the individual pawn structure terms.
+/// @details Verifies the sign of doubled, isolated and passed pawn terms, that mirrored
+///          structures cancel out and that pawn grids score like position lists.
+TEST_F(EvaluationTest, PawnStructureTerms)
+{
+  // Mirrored structures cancel out
+  Score balanced = pawn_structure({{'a', '2'}, {'b', '3'}, {'e', '4'}}, {{'a', '7'}, {'b', '6'}, {'e', '5'}});
+  EXPECT_EQ(balanced.mg, 0);
+  EXPECT_EQ(balanced.eg, 0);
+
+  // Doubled pawns are worse than the same pawns side by side
+  Score doubled      = pawn_structure({{'d', '2'}, {'d', '3'}}, {{'d', '7'}, {'e', '7'}});
+  Score side_by_side = pawn_structure({{'d', '2'}, {'e', '2'}}, {{'d', '7'}, {'e', '7'}});
+  EXPECT_LT(doubled.eg, side_by_side.eg);
+
+  // An isolated white pawn facing a healthy black chain is penalized
+  Score isolated = pawn_structure({{'a', '2'}, {'c', '2'}}, {{'a', '7'}, {'b', '7'}});
+  EXPECT_LT(isolated.mg, 0);
+
+  // A lone advanced passed pawn is rewarded, more so close to promotion
+  Score passed_far  = pawn_structure({{'e', '3'}}, {{'a', '7'}});
+  Score passed_near = pawn_structure({{'e', '6'}}, {{'a', '7'}});
+  EXPECT_GT(passed_near.eg, passed_far.eg);
+
+  // Pawn grids give the same score as position lists
+  PawnGrid white_grid = {};
+  PawnGrid black_grid = {};
+  white_grid['e' - 'a']['6' - '1'] = true;
+  black_grid['a' - 'a']['7' - '1'] = true;
+
+  Score passed_grid = pawn_grid_structure(white_grid, black_grid);
+  EXPECT_EQ(passed_grid.mg, passed_near.mg);
+  EXPECT_EQ(passed_grid.eg, passed_near.eg);
+}
+
+/// @brief   Test the pawn key and the pawn hash table.
+/// @details Verifies that only pawns change the pawn key, that the key is
+///          order independent, and that repeated evaluations hit the cache.
+TEST_F(EvaluationTest, PawnHashTable)
+{
+  EXPECT_EQ(p_test_board->getPawnKey(), 0u);
+
+  p_test_board->addPiece(std::make_unique<Pawn>('e', '4', Piece::Color::WHITE));
+  p_test_board->addPiece(std::make_unique<Pawn>('d', '5', Piece::Color::BLACK));
+  ZobristKey pawn_key = p_test_board->getPawnKey();
+  EXPECT_NE(pawn_key, 0u);
+
+  // Non-pawn pieces do not change the pawn key
+  p_test_board->addPiece(std::make_unique<Queen>('d', '1', Piece::Color::WHITE));
+  EXPECT_EQ(p_test_board->getPawnKey(), pawn_key);
+
+  // The same pawns added in another order give the same key
+  Board other_board;
+  other_board.addPiece(std::make_unique<Pawn>('d', '5', Piece::Color::BLACK));
+  other_board.addPiece(std::make_unique<Pawn>('e', '4', Piece::Color::WHITE));
+  EXPECT_EQ(other_board.getPawnKey(), pawn_key);
+
+  // The first evaluation misses, the second one hits
+  PawnHashTable& table = PawnHashTable::local();
+  table.clear();
+  int first = p_test_board->evaluate();
+  EXPECT_EQ(table.getHits(), 0u);
+  EXPECT_EQ(p_test_board->evaluate(), first);
+  EXPECT_EQ(table.getProbes(), 2u);
+  EXPECT_EQ(table.getHits(), 1u);
+  EXPECT_DOUBLE_EQ(table.getHitRate(), 0.5);
+}
@@ -0,0 +1,117 @@
+/// @file      test_ichess.cpp
+/// @brief     Unit tests for the C interface using Google Test framework.
+/// @author    Calileus
+/// @date      2026-10-18
+/// @copyright 2026 Obsidian Honor Coders. Licensed under Apache 2.0.
+/// @see       https://github.com/ObsidianHonorCoders/inheritance-chess
+/// @details   Test suite for the C interface functionality including:
+///             - Board creation, setup and destruction
+///             - Move listing into caller-provided buffers
+///             - Single move checks and evaluation
+///             - Batch evaluation and batch move listing over FEN arrays
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "ichess.h"
+
+static const char* const start_fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+/// @brief   Test the lifetime and setup of a board through the C interface.
+/// @details Verifies creation, FEN loading, error codes and destruction.
+TEST(IchessCApiTest, BoardLifetime)
+{
+  ichess_board* board = ichess_board_create();
+  ASSERT_NE(board, nullptr);
+
+  int score = 1;
+  EXPECT_EQ(ichess_board_evaluate(board, &score), ICHESS_OK);
+  EXPECT_EQ(score, 0);
+
+  EXPECT_EQ(ichess_board_load_fen(board, start_fen), ICHESS_OK);
+  EXPECT_EQ(ichess_board_load_fen(board, "not a fen"), ICHESS_INVALID_FEN);
+  EXPECT_EQ(ichess_board_load_fen(board, nullptr), ICHESS_INVALID_ARGUMENT);
+  EXPECT_EQ(ichess_board_standard_setup(nullptr), ICHESS_INVALID_ARGUMENT);
+  EXPECT_EQ(ichess_board_evaluate(nullptr, &score), ICHESS_INVALID_ARGUMENT);
+
+  ichess_board_destroy(board);
+  ichess_board_destroy(nullptr);
+}
+
+/// @brief   Test move listing and single move checks through the C interface.
+/// @details Verifies that a too small buffer is reported with the full count.
+TEST(IchessCApiTest, MovesIntoCallerBuffer)
+{
+  ichess_board* board = ichess_board_create();
+  ASSERT_EQ(ichess_board_standard_setup(board), ICHESS_OK);
+
+  std::vector<ichess_move> moves(4);
+  size_t                   count = 0;
+  EXPECT_EQ(ichess_board_pseudo_legal_moves(board, moves.data(), moves.size(), &count), ICHESS_BUFFER_TOO_SMALL);
+  EXPECT_EQ(count, 16u);
+
+  moves.resize(count);
+  EXPECT_EQ(ichess_board_pseudo_legal_moves(board, moves.data(), moves.size(), &count), ICHESS_OK);
+  for (const ichess_move& move : moves)
+  {
+    EXPECT_EQ(ichess_board_is_pseudo_legal(board, move), 1);
+  }
+  EXPECT_EQ(ichess_board_is_pseudo_legal(board, {'e', '2', 'e', '5'}), 0);
+  EXPECT_EQ(ichess_board_is_pseudo_legal(nullptr, {'e', '2', 'e', '4'}), ICHESS_INVALID_ARGUMENT);
+
+  ichess_board_destroy(board);
+}
+
+/// @brief   Test batch evaluation over an array of FEN strings.
+/// @details Verifies per-position scores and statuses, including a bad FEN.
+TEST(IchessCApiTest, EvaluateBatch)
+{
+  const char* fens[]      = {start_fen, "4k3/8/8/8/8/8/8/3QK3 w - - 0 1", "bad", "4k3/8/8/8/8/8/8/3qK3 w - - 0 1"};
+  int         scores[4]   = {};
+  int         statuses[4] = {};
+
+  EXPECT_EQ(ichess_evaluate_fens(fens, 4, scores, statuses), ICHESS_INVALID_FEN);
+  EXPECT_EQ(scores[0], 0);
+  EXPECT_GT(scores[1], 0);
+  EXPECT_EQ(scores[2], 0);
+  EXPECT_LT(scores[3], 0);
+  EXPECT_EQ(statuses[0], ICHESS_OK);
+  EXPECT_EQ(statuses[2], ICHESS_INVALID_FEN);
+
+  EXPECT_EQ(ichess_evaluate_fens(fens, 2, scores, nullptr), ICHESS_OK);
+
+  // A null entry is an invalid argument, not an invalid FEN
+  fens[1] = nullptr;
+  EXPECT_EQ(ichess_evaluate_fens(fens, 2, scores, statuses), ICHESS_INVALID_ARGUMENT);
+  EXPECT_EQ(statuses[1], ICHESS_INVALID_ARGUMENT);
+}
+
+/// @brief   Test batch move listing over an array of FEN strings.
+/// @details Verifies the offsets layout, the retry path when the buffer is too small and null entries.
+TEST(IchessCApiTest, PseudoLegalMovesBatch)
+{
+  const char* fens[]     = {start_fen, "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1"};
+  size_t      offsets[3] = {};
+
+  EXPECT_EQ(ichess_pseudo_legal_moves_fens(fens, 2, nullptr, 0, offsets), ICHESS_BUFFER_TOO_SMALL);
+  EXPECT_EQ(offsets[0], 0u);
+  EXPECT_EQ(offsets[1], 16u);
+  EXPECT_EQ(offsets[2], 18u);
+
+  std::vector<ichess_move> moves(offsets[2]);
+  EXPECT_EQ(ichess_pseudo_legal_moves_fens(fens, 2, moves.data(), moves.size(), offsets), ICHESS_OK);
+  EXPECT_EQ(moves[16].start_file, 'e');
+  EXPECT_EQ(moves[16].end_rank, '3');
+  EXPECT_EQ(moves[17].end_rank, '4');
+
+  // A null entry gets no moves and is reported as an invalid argument
+  fens[0] = nullptr;
+  EXPECT_EQ(ichess_pseudo_legal_moves_fens(fens, 2, moves.data(), moves.size(), offsets), ICHESS_INVALID_ARGUMENT);
+  EXPECT_EQ(offsets[1], 0u);
+  EXPECT_EQ(offsets[2], 2u);
+
+  // A too small buffer is reported even when a position failed
+  EXPECT_EQ(ichess_pseudo_legal_moves_fens(fens, 2, moves.data(), 1, offsets), ICHESS_BUFFER_TOO_SMALL);
+  EXPECT_EQ(offsets[2], 2u);
+}
@@ -9,6 +9,7 @@
 ///             - Single and double step forward movement
 ///             - Diagonal capture moves
 ///             - En passant capture moves
+///             - Capture-only and quiet-only move generation
 /// @note      Uses std::unique_ptr for automatic memory management
 ///            following modern C++ RAII principles.
 
@@ -334,3 +335,97 @@ TEST_F(PawnTest, EnPassantExpiresAfterOneTurn)
     EXPECT_TRUE(expected_moves[i].rank == moves[i].rank);
   }
 }
+
+/// @brief   Test capture-only move generation for pawns.
+/// @details Verifies that available_captures() returns the diagonal and en passant
+///          captures of available_moves() in the same order, and no forward moves.
+TEST_F(PawnTest, CaptureOnlyMoves)
+{
+  // Black pawn just moved from f7 to f5, next to the white pawn at e5
+  props                       = default_properties;
+  props.last_move_start       = {'f', '7'};
+  props.last_move_end         = {'f', '5'};
+  props.turns_since_pawn_move = 0;
+
+  other_pieces = {{'d', '6'}, {'f', '5'}};
+  other_colors = {Piece::Color::BLACK, Piece::Color::BLACK};
+
+  // White pawn at e5 should capture d6 diagonally and f6 en passant
+  expected_moves.clear();
+  expected_moves.push_back({'d', '6'});
+  expected_moves.push_back({'f', '6'});
+  p_e5_white_pawn->available_captures(moves, other_pieces, other_colors, props);
+
+  EXPECT_EQ(moves.size(), 2);
+  for (int i = 0; i < moves.size(); i++)
+  {
+    EXPECT_TRUE(expected_moves[i].file == moves[i].file);
+    EXPECT_TRUE(expected_moves[i].rank == moves[i].rank);
+  }
+
+  // Without opponent pieces in reach there are no captures
+  props        = default_properties;
+  other_pieces = {{'e', '3'}};
+  other_colors = {Piece::Color::BLACK};
+  p_e2_white_pawn->available_captures(moves, other_pieces, other_colors, props);
+
+  EXPECT_TRUE(moves.empty());
+}
+
+/// @brief   Test quiet-only move generation for pawns.
+/// @details Verifies that available_quiets() returns the forward moves of
+///          available_moves() and skips every capture.
+TEST_F(PawnTest, QuietOnlyMoves)
+{
+  props = default_properties;
+
+  other_pieces = {{'d', '6'}, {'f', '6'}};
+  other_colors = {Piece::Color::WHITE, Piece::Color::WHITE};
+
+  // Black pawn at e7 should move to e6 and e5, captures on d6 and f6 are skipped
+  expected_moves.clear();
+  expected_moves.push_back({'e', '6'});
+  expected_moves.push_back({'e', '5'});
+  p_e7_black_pawn->available_quiets(moves, other_pieces, other_colors, props);
+
+  EXPECT_EQ(moves.size(), 2);
+  for (int i = 0; i < moves.size(); i++)
+  {
+    EXPECT_TRUE(expected_moves[i].file == moves[i].file);
+    EXPECT_TRUE(expected_moves[i].rank == moves[i].rank);
+  }
+
+  // A blocked pawn has no quiet moves
+  other_pieces = {{'e', '6'}};
+  other_colors = {Piece::Color::WHITE};
+  p_e7_black_pawn->available_quiets(moves, other_pieces, other_colors, props);
+
+  EXPECT_TRUE(moves.empty());
+}
+
+/// @brief   Test capture-only move generation for pawns on the edge files.
+/// @details Verifies that a pawn on the a-file or h-file only looks at the
+///          diagonal that is still inside the board.
+TEST_F(PawnTest, EdgeFileCapture)
+{
+  std::unique_ptr<Pawn> p_a4_white_pawn = std::make_unique<Pawn>('a', '4', Piece::Color::WHITE);
+  std::unique_ptr<Pawn> p_h5_black_pawn = std::make_unique<Pawn>('h', '5', Piece::Color::BLACK);
+
+  props        = default_properties;
+  other_pieces = {{'b', '5'}, {'g', '4'}};
+  other_colors = {Piece::Color::BLACK, Piece::Color::WHITE};
+
+  // White pawn at a4 can only capture b5
+  p_a4_white_pawn->available_captures(moves, other_pieces, other_colors, props);
+
+  EXPECT_EQ(moves.size(), 1);
+  EXPECT_TRUE(moves[0].file == 'b');
+  EXPECT_TRUE(moves[0].rank == '5');
+
+  // Black pawn at h5 can only capture g4
+  p_h5_black_pawn->available_captures(moves, other_pieces, other_colors, props);
+
+  EXPECT_EQ(moves.size(), 1);
+  EXPECT_TRUE(moves[0].file == 'g');
+  EXPECT_TRUE(moves[0].rank == '4');
+}